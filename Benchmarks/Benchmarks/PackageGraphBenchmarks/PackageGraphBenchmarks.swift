@@ -6,8 +6,13 @@ import PackageModel
 
 @_spi(DontAdoptOutsideOfSwiftPMExposedForBenchmarksAndTestsOnly)
 import func PackageGraph.loadModulesGraph
+import enum PackageGraph.DependencyResolutionNode
+import struct PackageGraph.Term
+import enum PackageGraph.VersionSetSpecifier
 
 import class TSCBasic.InMemoryFileSystem
+import func TSCBasic.topologicalSort
+import struct TSCUtility.Version
 import Workspace
 
 let benchmarks = {
@@ -110,6 +115,115 @@ let benchmarks = {
             includeMacros: true
         )
     }
+
+    // Benchmarks the topological sort of a synthetic modules graph with the integer-indexed `CompactGraph`, including
+    // the cost of building it, against the closure-based sort over `Hashable` nodes that it replaces.
+    let graphNodes = syntheticGraphNodes(depth: modulesGraphDepth, width: modulesGraphWidth)
+    Benchmark(
+        "CompactGraphTopologicalSort",
+        configuration: .init(
+            metrics: defaultMetrics,
+            maxDuration: .seconds(10)
+        )
+    ) { benchmark in
+        for _ in benchmark.scaledIterations {
+            try blackHole(CompactGraph(roots: graphNodes, successors: \.dependencies).topologicalSort())
+        }
+    }
+
+    Benchmark(
+        "ClosureTopologicalSort",
+        configuration: .init(
+            metrics: defaultMetrics,
+            maxDuration: .seconds(10)
+        )
+    ) { benchmark in
+        for _ in benchmark.scaledIterations {
+            try blackHole(topologicalSort(graphNodes, successors: \.dependencies))
+        }
+    }
+
+    // Benchmarks cycle detection over the same graph, which has no cycles and so is traversed in full.
+    Benchmark(
+        "CompactGraphFindCycle",
+        configuration: .init(
+            metrics: defaultMetrics,
+            maxDuration: .seconds(10)
+        )
+    ) { benchmark in
+        for _ in benchmark.scaledIterations {
+            blackHole(CompactGraph(roots: graphNodes, successors: \.dependencies).findCycle())
+        }
+    }
+
+    // Benchmarks the set relations between PubGrub terms that unit propagation computes, over version sets as they
+    // show up in the partial solution after a few derivations and backtracks.
+    let terms = syntheticTerms()
+    Benchmark(
+        "PubGrubTermRelations",
+        configuration: .init(
+            metrics: defaultMetrics,
+            maxDuration: .seconds(10)
+        )
+    ) { benchmark in
+        for _ in benchmark.scaledIterations {
+            for lhs in terms {
+                for rhs in terms {
+                    blackHole(lhs.relation(with: rhs))
+                }
+            }
+        }
+    }
+}
+
+/// A node standing in for a resolved module, which is hashed by its name and path on every set or dictionary access.
+final class SyntheticGraphNode: Hashable {
+    let name: String
+    let path: String
+    var dependencies: [SyntheticGraphNode] = []
+
+    init(name: String) {
+        self.name = name
+        self.path = "/benchmark/Sources/\(name)"
+    }
+
+    static func == (lhs: SyntheticGraphNode, rhs: SyntheticGraphNode) -> Bool {
+        lhs.name == rhs.name && lhs.path == rhs.path
+    }
+
+    func hash(into hasher: inout Hasher) {
+        hasher.combine(self.name)
+        hasher.combine(self.path)
+    }
+}
+
+/// Returns `width` nodes, each depending on up to `depth` of the nodes preceding it.
+func syntheticGraphNodes(depth: Int, width: Int) -> [SyntheticGraphNode] {
+    let nodes = (0..<width).map { SyntheticGraphNode(name: "Module\($0)") }
+    for (i, node) in nodes.enumerated() {
+        node.dependencies = Array(nodes[max(0, i - depth)..<i])
+    }
+    return nodes
+}
+
+/// Returns positive and negative terms of a single package, whose requirements are exact versions, ranges and lists
+/// of ranges.
+func syntheticTerms() -> [Term] {
+    let package = PackageReference.remoteSourceControl(
+        identity: .plain("benchmark"),
+        url: "https://example.com/benchmark.git"
+    )
+    let node = DependencyResolutionNode.root(package: package)
+    var requirements: [VersionSetSpecifier] = []
+    for major in 1 ... 4 {
+        requirements.append(.exact(Version(major, 2, 3)))
+        requirements.append(.range(Version(major, 0, 0) ..< Version(major + 1, 0, 0)))
+        requirements.append(.union(from: [
+            Version(major, 0, 0) ..< Version(major, 2, 0),
+            Version(major, 4, 0) ..< Version(major + 1, 0, 0),
+        ]))
+    }
+    return requirements.flatMap { [Term(node, $0), Term(not: node, $0)] }
 }
 
 func syntheticModulesGraph(
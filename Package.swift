@@ -513,7 +513,7 @@ let package = Package(
         .executableTarget(
             /** Builds packages */
             name: "swift-build",
-            dependencies: ["Commands"],
+            dependencies: ["Basics", "Commands"],
             exclude: ["CMakeLists.txt"]
         ),
         .executableTarget(
@@ -545,13 +545,13 @@ let package = Package(
         .executableTarget(
             /** Runs package tests */
             name: "swift-test",
-            dependencies: ["Commands"],
+            dependencies: ["Basics", "Commands"],
             exclude: ["CMakeLists.txt"]
         ),
         .executableTarget(
             /** Runs an executable product */
             name: "swift-run",
-            dependencies: ["Commands"],
+            dependencies: ["Basics", "Commands"],
             exclude: ["CMakeLists.txt"]
         ),
         .executableTarget(
@@ -639,6 +639,10 @@ let package = Package(
             name: "BuildTests",
             dependencies: ["Build", "PackageModel", "_InternalTestSupport"]
         ),
+        .testTarget(
+            name: "BuildPerformanceTests",
+            dependencies: ["Build", "PackageModel", "_InternalTestSupport"]
+        ),
         .testTarget(
             name: "LLBuildManifestTests",
             dependencies: ["Basics", "LLBuildManifest", "_InternalTestSupport"]
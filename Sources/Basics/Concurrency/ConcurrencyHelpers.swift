@@ -22,6 +22,23 @@ public enum Concurrency {
         Environment.current["SWIFTPM_MAX_CONCURRENT_OPERATIONS"].flatMap(Int.init) ?? ProcessInfo.processInfo
             .activeProcessorCount
     }
+
+    /// The GNU make jobserver SwiftPM was started from, which CPU-bound work beyond the first job draws tokens from,
+    /// so that SwiftPM doesn't oversubscribe the host when run from a larger build. Only set once
+    /// `captureJobServer()` was called.
+    public static var jobServer: JobServer? {
+        self.capturedJobServer.get()
+    }
+
+    private static let capturedJobServer = ThreadSafeBox<JobServer>()
+
+    /// Joins the jobserver SwiftPM was started from, if any. Entry points call this first thing, before any file is
+    /// opened, since the descriptors make passes on could otherwise already be in use by SwiftPM's own files.
+    public static func captureJobServer() {
+        if let jobServer = JobServer.inherited(from: .current) {
+            self.capturedJobServer.put(jobServer)
+        }
+    }
 }
 
 // FIXME: mark as deprecated once async/await is available
@@ -0,0 +1,165 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import Foundation
+
+#if canImport(Glibc)
+import Glibc
+#elseif canImport(Musl)
+import Musl
+#elseif os(Windows)
+import CRT
+#else
+import Darwin.C
+#endif
+
+/// A client of the GNU make jobserver that SwiftPM was started from, which limits the number of jobs all processes of
+/// a build run at once.
+///
+/// Every process of the build may run one job without asking. Each additional job takes a token, which is a byte read
+/// from a pipe or FIFO whose location make passes in `MAKEFLAGS`, and gives it back by writing the byte back when it
+/// finished.
+public final class JobServer: @unchecked Sendable {
+    /// A permission to run a job.
+    public struct Token {
+        let byte: UInt8?
+    }
+
+    private let readDescriptor: Int32
+    private let writeDescriptor: Int32
+    private let lock = NSLock()
+    private var isImplicitTokenAvailable = true
+
+    private init(readDescriptor: Int32, writeDescriptor: Int32) {
+        self.readDescriptor = readDescriptor
+        self.writeDescriptor = writeDescriptor
+    }
+
+    /// Joins the jobserver described by `MAKEFLAGS` in `environment`, if any.
+    ///
+    /// Both the `--jobserver-auth=fifo:PATH` form of make 4.4 and the `--jobserver-auth=R,W` form of earlier versions
+    /// are supported. Make only passes the descriptors of the latter on to recipes it knows to be sub-makes, so they
+    /// are ignored unless they are open and refer to a pipe. Since the descriptors are reused for the next files the
+    /// process opens otherwise, this has to be called before any file is opened, see
+    /// `Concurrency.captureJobServer()`.
+    public static func inherited(from environment: Environment) -> JobServer? {
+        #if os(Windows)
+        // The Windows jobserver is a named semaphore, which isn't supported.
+        return nil
+        #else
+        guard let auth = environment["MAKEFLAGS"].flatMap(Self.jobServerAuth(makeFlags:)) else {
+            return nil
+        }
+
+        if auth.hasPrefix("fifo:") {
+            let descriptor = open(String(auth.dropFirst("fifo:".count)), O_RDWR | O_CLOEXEC)
+            guard descriptor >= 0 else {
+                return nil
+            }
+            guard Self.isFIFO(descriptor) else {
+                close(descriptor)
+                return nil
+            }
+            return JobServer(readDescriptor: descriptor, writeDescriptor: descriptor)
+        }
+
+        let descriptors = auth.split(separator: ",").compactMap { Int32($0) }
+        guard descriptors.count == 2, descriptors.allSatisfy(Self.isFIFO) else {
+            return nil
+        }
+        return JobServer(readDescriptor: descriptors[0], writeDescriptor: descriptors[1])
+        #endif
+    }
+
+    #if !os(Windows)
+    /// Whether `descriptor` is open and refers to a pipe or FIFO.
+    private static func isFIFO(_ descriptor: Int32) -> Bool {
+        var info = stat()
+        return fstat(descriptor, &info) == 0 && (info.st_mode & S_IFMT) == S_IFIFO
+    }
+    #endif
+
+    /// The value of the last jobserver option in `makeFlags`.
+    static func jobServerAuth(makeFlags: String) -> String? {
+        let prefixes = ["--jobserver-auth=", "--jobserver-fds="]
+        return makeFlags.split(separator: " ").reversed().lazy.compactMap { flag in
+            prefixes.first { flag.hasPrefix($0) }.map { String(flag.dropFirst($0.count)) }
+        }.first
+    }
+
+    /// Waits for a token.
+    public func acquire() throws -> Token {
+        if self.lock.withLock({ () -> Bool in
+            defer { self.isImplicitTokenAvailable = false }
+            return self.isImplicitTokenAvailable
+        }) {
+            return Token(byte: nil)
+        }
+
+        #if os(Windows)
+        throw InternalError("jobserver isn't supported on Windows")
+        #else
+        var byte: UInt8 = 0
+        while true {
+            let result = read(self.readDescriptor, &byte, 1)
+            if result == 1 {
+                return Token(byte: byte)
+            }
+            if result == 0 {
+                throw StringError("the jobserver was closed")
+            }
+            switch errno {
+            case EINTR:
+                continue
+            case EAGAIN:
+                // Make may hand out non-blocking descriptors.
+                var descriptor = pollfd(fd: self.readDescriptor, events: Int16(POLLIN), revents: 0)
+                _ = poll(&descriptor, 1, -1)
+            default:
+                throw StringError("failed to read from the jobserver: \(String(cString: strerror(errno)))")
+            }
+        }
+        #endif
+    }
+
+    /// Gives back a token acquired with `acquire()`.
+    public func release(_ token: Token) {
+        guard var byte = token.byte else {
+            self.lock.withLock {
+                self.isImplicitTokenAvailable = true
+            }
+            return
+        }
+
+        #if !os(Windows)
+        while write(self.writeDescriptor, &byte, 1) == -1 && errno == EINTR {}
+        #endif
+    }
+
+    /// Waits for a token, or returns `nil` if the jobserver failed, in which case the job should run anyway rather than
+    /// fail because of the enclosing build.
+    public func acquireIfAvailable(observabilityScope: ObservabilityScope) -> Token? {
+        do {
+            return try self.acquire()
+        } catch {
+            observabilityScope.emit(debug: "failed to acquire a jobserver token", underlyingError: error)
+            return nil
+        }
+    }
+
+    /// Runs `body` while holding a token.
+    public func withToken<T>(_ body: () throws -> T) throws -> T {
+        let token = try self.acquire()
+        defer { self.release(token) }
+        return try body()
+    }
+}
@@ -0,0 +1,96 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import struct Foundation.Date
+import class Foundation.JSONDecoder
+import class Foundation.JSONEncoder
+
+/// Records when the entries of a cache directory were last used, so that the least recently used entries can be
+/// evicted first when the cache grows beyond its budget.
+///
+/// The record is stored as a JSON file at the root of the cache directory and is updated under a file lock, so it
+/// can be shared by concurrent SwiftPM processes.
+public struct CacheAccessRecord {
+    /// The name of the file holding the record inside of the cache directory.
+    public static let filename = ".access-record.json"
+
+    /// The cache directory whose entries are recorded.
+    public let cacheDirectory: AbsolutePath
+
+    private let fileSystem: FileSystem
+
+    private var path: AbsolutePath {
+        self.cacheDirectory.appending(component: Self.filename)
+    }
+
+    public init(cacheDirectory: AbsolutePath, fileSystem: FileSystem) {
+        self.cacheDirectory = cacheDirectory
+        self.fileSystem = fileSystem
+    }
+
+    /// Records that the entry at the given path relative to the cache directory was used at `date`.
+    public func recordAccess(to entry: RelativePath, at date: Date = Date()) throws {
+        try self.update { $0[entry.pathString] = date.timeIntervalSince1970 }
+    }
+
+    /// Removes the given entries from the record.
+    public func removeEntries(_ entries: [RelativePath]) throws {
+        guard !entries.isEmpty else {
+            return
+        }
+        try self.update { timestamps in
+            for entry in entries {
+                timestamps[entry.pathString] = nil
+            }
+        }
+    }
+
+    /// Returns the recorded last access dates, keyed by paths relative to the cache directory.
+    public func lastAccessDates() throws -> [RelativePath: Date] {
+        try self.fileSystem.withLock(on: self.path, type: .shared) {
+            try self.load().reduce(into: [:]) { result, element in
+                result[try RelativePath(validating: element.key)] = Date(timeIntervalSince1970: element.value)
+            }
+        }
+    }
+
+    private func update(_ body: (inout [String: Double]) throws -> Void) throws {
+        if !self.fileSystem.exists(self.cacheDirectory) {
+            try self.fileSystem.createDirectory(self.cacheDirectory, recursive: true)
+        }
+        try self.fileSystem.withLock(on: self.path, type: .exclusive) {
+            var timestamps = try self.load()
+            try body(&timestamps)
+            try JSONEncoder.makeWithDefaults(prettified: false).encode(
+                path: self.path,
+                fileSystem: self.fileSystem,
+                timestamps
+            )
+        }
+    }
+
+    private func load() throws -> [String: Double] {
+        guard self.fileSystem.exists(self.path) else {
+            return [:]
+        }
+        do {
+            return try JSONDecoder.makeWithDefaults().decode(
+                path: self.path,
+                fileSystem: self.fileSystem,
+                as: [String: Double].self
+            )
+        } catch {
+            // A corrupted record only degrades the eviction order, start over.
+            return [:]
+        }
+    }
+}
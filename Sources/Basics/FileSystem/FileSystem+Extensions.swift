@@ -590,6 +590,21 @@ extension FileSystem {
     }
 }
 
+extension FileSystem {
+    /// Returns the total size in bytes of the files in the file tree at `path`, without following symbolic links.
+    public func fileTreeSize(_ path: AbsolutePath) throws -> UInt64 {
+        if self.isSymlink(path) {
+            return 0
+        }
+        guard self.isDirectory(path) else {
+            return try self.getFileInfo(path).size
+        }
+        return try self.getDirectoryContents(path).reduce(0) {
+            try $0 + self.fileTreeSize(path.appending(component: $1))
+        }
+    }
+}
+
 extension FileSystem {
     public func forceCreateDirectory(at path: AbsolutePath) throws {
         try self.createDirectory(path.parentDirectory, recursive: true)
@@ -0,0 +1,202 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import enum TSCBasic.GraphError
+
+/// Graph of the nodes reachable from a list of roots, stored in
+/// [compressed sparse row](https://en.wikipedia.org/wiki/Sparse_matrix#Compressed_sparse_row_(CSR,_CRS_or_Yale_format))
+/// form.
+///
+/// Each node is hashed only once, when the graph is built. Traversals then work on integer indices with bit sets
+/// for visited nodes and explicit stacks instead of recursion, so they neither hash nor copy the nodes, which
+/// matters when nodes are large values such as `ResolvedModule`. The algorithms produce the same results as their
+/// closure-based counterparts over `Hashable` nodes.
+public struct CompactGraph<Node: Hashable> {
+    /// The nodes of the graph, indexed in the order in which they were first reached.
+    public let nodes: [Node]
+
+    /// The indices of the roots the graph was built from, in their original order and including duplicates.
+    public let roots: [Int]
+
+    /// The successors of the node at index `i` are stored at `edges[edgeOffsets[i] ..< edgeOffsets[i + 1]]`.
+    private let edgeOffsets: [Int]
+    private let edges: [Int]
+
+    /// Builds the graph of the nodes reachable from `roots` via `successors`, which is called exactly once for each
+    /// unique node.
+    public init(roots: [Node], successors: (Node) throws -> [Node]) rethrows {
+        var indices = [Node: Int]()
+        var nodes = [Node]()
+
+        func index(of node: Node) -> Int {
+            if let index = indices[node] {
+                return index
+            }
+            let index = nodes.count
+            indices[node] = index
+            nodes.append(node)
+            return index
+        }
+
+        let roots = roots.map(index(of:))
+
+        // Nodes are appended as they are discovered, so this visits every reachable node in breadth-first order.
+        var edgeOffsets = [0]
+        var edges = [Int]()
+        var current = 0
+        while current < nodes.count {
+            for successor in try successors(nodes[current]) {
+                edges.append(index(of: successor))
+            }
+            edgeOffsets.append(edges.count)
+            current += 1
+        }
+
+        self.nodes = nodes
+        self.roots = roots
+        self.edgeOffsets = edgeOffsets
+        self.edges = edges
+    }
+
+    /// The number of edges in the graph.
+    public var edgeCount: Int {
+        self.edges.count
+    }
+
+    /// Returns the indices of the successors of the node at `index`.
+    public func successors(of index: Int) -> ArraySlice<Int> {
+        self.edges[self.edgeOffsets[index] ..< self.edgeOffsets[index + 1]]
+    }
+
+    /// Returns the indices of the nodes in topological order, so that every node precedes its successors.
+    ///
+    /// - Throws: `GraphError.unexpectedCycle` if the graph contains a cycle.
+    public func topologicalSortIndices() throws -> [Int] {
+        var visited = BitSet(count: self.nodes.count)
+        var onStack = BitSet(count: self.nodes.count)
+        var stack = [(node: Int, nextEdge: Int)]()
+        var result = [Int]()
+        result.reserveCapacity(self.nodes.count)
+
+        for root in self.roots where visited.insert(root) {
+            onStack.insert(root)
+            stack.append((root, self.edgeOffsets[root]))
+
+            while let top = stack.last {
+                let (node, nextEdge) = top
+                guard nextEdge < self.edgeOffsets[node + 1] else {
+                    // All successors are done, this node comes before them in the reversed post-order.
+                    stack.removeLast()
+                    onStack.remove(node)
+                    result.append(node)
+                    continue
+                }
+
+                stack[stack.count - 1].nextEdge += 1
+                let successor = self.edges[nextEdge]
+                if onStack.contains(successor) {
+                    throw GraphError.unexpectedCycle
+                }
+                if visited.insert(successor) {
+                    onStack.insert(successor)
+                    stack.append((successor, self.edgeOffsets[successor]))
+                }
+            }
+        }
+
+        return result.reversed()
+    }
+
+    /// Returns the nodes in topological order, so that every node precedes its successors.
+    ///
+    /// - Throws: `GraphError.unexpectedCycle` if the graph contains a cycle.
+    public func topologicalSort() throws -> [Node] {
+        try self.topologicalSortIndices().map { self.nodes[$0] }
+    }
+
+    /// Finds the first cycle reachable from the roots.
+    ///
+    /// - Returns: The indices of the nodes on the path from a root to the cycle and of the nodes in the cycle, or
+    ///   `nil` if the graph has no cycle.
+    public func findCycleIndices() -> (path: [Int], cycle: [Int])? {
+        // Nodes from which no cycle is reachable.
+        var valid = BitSet(count: self.nodes.count)
+        var onPath = BitSet(count: self.nodes.count)
+        var path = [(node: Int, nextEdge: Int)]()
+
+        for root in self.roots where !valid.contains(root) {
+            onPath.insert(root)
+            path.append((root, self.edgeOffsets[root]))
+
+            while let top = path.last {
+                let (node, nextEdge) = top
+                guard nextEdge < self.edgeOffsets[node + 1] else {
+                    path.removeLast()
+                    onPath.remove(node)
+                    valid.insert(node)
+                    continue
+                }
+
+                path[path.count - 1].nextEdge += 1
+                let successor = self.edges[nextEdge]
+                if valid.contains(successor) {
+                    continue
+                }
+                if onPath.contains(successor) {
+                    let cycleStart = path.firstIndex { $0.node == successor }!
+                    return (path[..<cycleStart].map(\.node), path[cycleStart...].map(\.node))
+                }
+                onPath.insert(successor)
+                path.append((successor, self.edgeOffsets[successor]))
+            }
+        }
+
+        return nil
+    }
+
+    /// Finds the first cycle reachable from the roots.
+    ///
+    /// - Returns: The nodes on the path from a root to the cycle and the nodes in the cycle, or `nil` if the graph
+    ///   has no cycle.
+    public func findCycle() -> (path: [Node], cycle: [Node])? {
+        self.findCycleIndices().map { cycle in
+            (cycle.path.map { self.nodes[$0] }, cycle.cycle.map { self.nodes[$0] })
+        }
+    }
+}
+
+/// A fixed-size set of small non-negative integers, such as indices of nodes in a graph.
+struct BitSet {
+    private var words: [UInt64]
+
+    /// Creates an empty set that can hold integers in `0 ..< count`.
+    init(count: Int) {
+        self.words = .init(repeating: 0, count: (count + 63) / 64)
+    }
+
+    func contains(_ element: Int) -> Bool {
+        self.words[element / 64] & (1 << UInt64(element % 64)) != 0
+    }
+
+    /// Inserts `element` and returns `true` if it wasn't in the set yet.
+    @discardableResult
+    mutating func insert(_ element: Int) -> Bool {
+        let mask: UInt64 = 1 << UInt64(element % 64)
+        let word = self.words[element / 64]
+        self.words[element / 64] = word | mask
+        return word & mask == 0
+    }
+
+    mutating func remove(_ element: Int) {
+        self.words[element / 64] &= ~(1 << UInt64(element % 64))
+    }
+}
@@ -24,6 +24,9 @@ final class URLSessionHTTPClient: Sendable {
     private let dataTaskManager: DataTaskManager
     private let downloadTaskManager: DownloadTaskManager
 
+    /// `URLSession` calls the delegates one at a time on their queues, which only keep the state of the tasks. The
+    /// progress and completion handlers of each task run on a queue of the task, so that slow handlers of one task
+    /// don't hold up the other tasks.
     init(configuration: URLSessionConfiguration = .default) {
         let dataDelegateQueue = OperationQueue()
         dataDelegateQueue.name = "org.swift.swiftpm.urlsession-http-client-data-delegate"
@@ -124,6 +127,8 @@ final class URLSessionHTTPClient: Sendable {
 }
 
 private final class DataTaskManager: NSObject, URLSessionDataDelegate {
+    private static let maxPreallocatedBufferSize: Int64 = 64 * 1024 * 1024
+
     private let tasks = ThreadSafeKeyValueStore<Int, DataTask>()
 
     func register(
@@ -148,50 +153,58 @@ private final class DataTaskManager: NSObject, URLSessionDataDelegate {
         didReceive response: URLResponse,
         completionHandler: @escaping (URLSession.ResponseDisposition) -> Void
     ) {
-        guard var task = self.tasks[dataTask.taskIdentifier] else {
+        guard let task = self.tasks[dataTask.taskIdentifier] else {
             return completionHandler(.cancel)
         }
         task.response = response as? HTTPURLResponse
         task.expectedContentLength = response.expectedContentLength
-        self.tasks[dataTask.taskIdentifier] = task
 
-        do {
-            try task.progressHandler?(0, response.expectedContentLength)
-            completionHandler(.allow)
-        } catch {
-            completionHandler(.cancel)
+        // Whether the response is accepted depends on the progress handler, so it's called synchronously, on the
+        // queue of the task to stay ordered with the other handlers of the task.
+        let disposition: URLSession.ResponseDisposition = task.callbackQueue.sync {
+            do {
+                try task.progressHandler?(0, response.expectedContentLength)
+                return .allow
+            } catch {
+                return .cancel
+            }
         }
+        completionHandler(disposition)
     }
 
     public func urlSession(_ session: URLSession, dataTask: URLSessionDataTask, didReceive data: Data) {
-        guard var task = self.tasks[dataTask.taskIdentifier] else {
+        guard let task = self.tasks[dataTask.taskIdentifier] else {
             return
         }
+        // The buffer is only referenced by the task, so appending to it doesn't copy what was received before.
         if task.buffer != nil {
             task.buffer?.append(data)
+        } else if let expectedContentLength = task.expectedContentLength, expectedContentLength > data.count {
+            // Allocate the whole body at once, but trust the server with no more than 64 MiB.
+            var buffer = Data(capacity: Int(min(expectedContentLength, Self.maxPreallocatedBufferSize)))
+            buffer.append(data)
+            task.buffer = buffer
         } else {
             task.buffer = data
         }
-        self.tasks[dataTask.taskIdentifier] = task
 
-        do {
-            // safe since created in the line above
-            try task.progressHandler?(Int64(task.buffer?.count ?? 0), task.expectedContentLength)
-        } catch {
-            task.task.cancel()
-        }
+        task.reportProgress(bytesReceived: Int64(task.buffer?.count ?? 0), totalBytes: task.expectedContentLength)
     }
 
     public func urlSession(_ session: URLSession, task: URLSessionTask, didCompleteWithError error: Error?) {
         guard let task = self.tasks.removeValue(forKey: task.taskIdentifier) else {
             return
         }
+        let result: Result<HTTPClientResponse, Error>
         if let error {
-            task.completionHandler(.failure(error))
+            result = .failure(error)
         } else if let response = task.response {
-            task.completionHandler(.success(response.response(body: task.buffer)))
+            result = .success(response.response(body: task.buffer))
         } else {
-            task.completionHandler(.failure(HTTPClientError.invalidResponse))
+            result = .failure(HTTPClientError.invalidResponse)
+        }
+        task.callbackQueue.async {
+            task.completionHandler(result)
         }
     }
 
@@ -218,8 +231,11 @@ private final class DataTaskManager: NSObject, URLSessionDataDelegate {
         completionHandler(request)
     }
 
-    struct DataTask: Sendable {
+    /// The state of a data task, which is a class so that the response body is appended to in place. It is only
+    /// mutated by the delegate callbacks, which `URLSession` calls one at a time.
+    final class DataTask: @unchecked Sendable {
         let task: URLSessionDataTask
+        let callbackQueue = DispatchQueue(label: "org.swift.swiftpm.urlsession-http-client-data-task")
         let completionHandler: LegacyHTTPClient.CompletionHandler
         /// A strong reference to keep the `DataTaskManager` alive so it can handle the callbacks from the
         /// `URLSession`.
@@ -246,6 +262,21 @@ private final class DataTaskManager: NSObject, URLSessionDataDelegate {
             self.completionHandler = completionHandler
             self.authorizationProvider = authorizationProvider
         }
+
+        /// Calls the progress handler on the queue of the task, and cancels the task if the handler throws.
+        func reportProgress(bytesReceived: Int64, totalBytes: Int64?) {
+            guard let progressHandler = self.progressHandler else {
+                return
+            }
+            let task = self.task
+            self.callbackQueue.async {
+                do {
+                    try progressHandler(bytesReceived, totalBytes)
+                } catch {
+                    task.cancel()
+                }
+            }
+        }
     }
 }
 
@@ -284,10 +315,15 @@ private final class DownloadTaskManager: NSObject, URLSessionDownloadDelegate {
         let totalBytesToDownload = totalBytesExpectedToWrite != NSURLSessionTransferSizeUnknown ?
             totalBytesExpectedToWrite : nil
 
-        do {
-            try task.progressHandler?(totalBytesWritten, totalBytesToDownload)
-        } catch {
-            task.task.cancel()
+        guard let progressHandler = task.progressHandler else {
+            return
+        }
+        task.callbackQueue.async {
+            do {
+                try progressHandler(totalBytesWritten, totalBytesToDownload)
+            } catch {
+                task.task.cancel()
+            }
         }
     }
 
@@ -322,23 +358,24 @@ private final class DownloadTaskManager: NSObject, URLSessionDownloadDelegate {
             return
         }
 
-        do {
-            if let error {
-                throw HTTPClientError.downloadError(error.interpolationDescription)
-            } else if let error = task.moveFileError {
-                throw error
-            } else if let response = downloadTask.response as? HTTPURLResponse {
-                task.completionHandler(.success(response.response(body: nil)))
-            } else {
-                throw HTTPClientError.invalidResponse
-            }
-        } catch {
-            task.completionHandler(.failure(error))
+        let result: Result<HTTPClientResponse, Error>
+        if let error {
+            result = .failure(HTTPClientError.downloadError(error.interpolationDescription))
+        } else if let error = task.moveFileError {
+            result = .failure(error)
+        } else if let response = downloadTask.response as? HTTPURLResponse {
+            result = .success(response.response(body: nil))
+        } else {
+            result = .failure(HTTPClientError.invalidResponse)
+        }
+        task.callbackQueue.async {
+            task.completionHandler(result)
         }
     }
 
     struct DownloadTask: Sendable {
         let task: URLSessionDownloadTask
+        let callbackQueue = DispatchQueue(label: "org.swift.swiftpm.urlsession-http-client-download-task")
         let fileSystem: FileSystem
         let destination: AbsolutePath
         let progressHandler: LegacyHTTPClient.ProgressHandler?
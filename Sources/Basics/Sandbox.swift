@@ -65,12 +65,37 @@ public enum Sandbox {
             allowNetworkConnections: allowNetworkConnections
         )
         return ["/usr/bin/sandbox-exec", "-p", profile] + command
+        #elseif os(Linux)
+        guard let bubblewrap = linuxSandboxExecutable else {
+            return command
+        }
+        let arguments = try linuxSandboxArguments(
+            fileSystem: fileSystem,
+            strictness: strictness,
+            writableDirectories: writableDirectories,
+            readOnlyDirectories: readOnlyDirectories,
+            allowNetworkConnections: allowNetworkConnections
+        )
+        return [bubblewrap.pathString] + arguments + ["--"] + command
         #else
         // rdar://40235432, rdar://75636874 tracks implementing sandboxes for other platforms.
         return command
         #endif
     }
 
+    /// Whether `apply` actually sandboxes command lines on this host.
+    ///
+    /// On Linux, this requires `bwrap` (bubblewrap) to be installed and unprivileged user namespaces to be enabled.
+    public static var isAvailable: Bool {
+        #if os(macOS)
+        return true
+        #elseif os(Linux)
+        return linuxSandboxExecutable != nil
+        #else
+        return false
+        #endif
+    }
+
     /// Basic strictness level of a sandbox applied to a command line.
     public enum Strictness: Equatable {
         /// Blocks network access and all file system modifications.
@@ -237,3 +262,85 @@ extension AbsolutePath {
     }
 }
 #endif
+
+// MARK: - Linux
+
+#if os(Linux)
+/// The `bwrap` executable used to sandbox command lines, or `nil` if it isn't installed or can't create the
+/// namespaces it needs, for example because unprivileged user namespaces are disabled. The check runs once per
+/// process so that sandboxing a command only costs the few milliseconds it takes to set up the namespaces.
+fileprivate let linuxSandboxExecutable: AbsolutePath? = {
+    guard let bubblewrap = AsyncProcess.findExecutable("bwrap") else {
+        return nil
+    }
+    let probe = [
+        bubblewrap.pathString,
+        "--unshare-net", "--unshare-pid", "--die-with-parent",
+        "--ro-bind", "/", "/", "--dev", "/dev", "--proc", "/proc",
+        "--", "true",
+    ]
+    guard (try? AsyncProcess.checkNonZeroExit(arguments: probe)) != nil else {
+        return nil
+    }
+    return bubblewrap
+}()
+
+/// Returns the `bwrap` arguments that mirror the macOS sandbox profile: the whole file system is mounted read-only,
+/// and the writable directories are bind-mounted read-write on top of it. Later mounts shadow earlier ones, so the
+/// mounts are emitted in the same order as the rules of the macOS profile.
+fileprivate func linuxSandboxArguments(
+    fileSystem: FileSystem,
+    strictness: Sandbox.Strictness,
+    writableDirectories: [AbsolutePath],
+    readOnlyDirectories: [AbsolutePath],
+    allowNetworkConnections: [SandboxNetworkPermission]
+) throws -> [String] {
+    var arguments = ["--die-with-parent", "--unshare-pid"]
+
+    // A new network namespace only has its own loopback interface, so this blocks local connections too.
+    if allowNetworkConnections.filter({ $0 != .none }).isEmpty {
+        arguments += ["--unshare-net"]
+    }
+
+    // Allow reading all files; ideally we'd only allow the package directory and any dependencies,
+    // but all kinds of system locations need to be accessible.
+    arguments += ["--ro-bind", "/", "/", "--dev", "/dev", "--proc", "/proc"]
+
+    // Mounts that don't exist on the host are skipped rather than failing the whole command.
+    func mount(_ path: AbsolutePath, writable: Bool) throws {
+        let path = try resolveSymlinks(path).pathString
+        arguments += [writable ? "--bind-try" : "--ro-bind-try", path, path]
+    }
+
+    // The following accesses are only needed when interpreting the manifest (versus running a compiled version).
+    if strictness == .manifest_pre_53 {
+        // This is where clang stores its module cache by default.
+        if let cachesDirectory = fileSystem.cachesDirectory {
+            try mount(cachesDirectory.appending("clang"), writable: true)
+        }
+    }
+    // Optionally allow writing to temporary directories (a lot of use of Foundation requires this).
+    else if strictness == .writableTemporaryDirectory {
+        for tmpDir in Set(["/tmp", NSTemporaryDirectory()]) {
+            try mount(AbsolutePath(validating: tmpDir), writable: true)
+        }
+    }
+
+    // Paths under which writing should be disallowed, even if they would be covered by a previous mount.
+    for path in readOnlyDirectories {
+        try mount(path, writable: false)
+    }
+
+    // Paths under which writing is allowed, even if they are descendants of directories that are otherwise
+    // read-only. For any explicit writable directories, also include the relevant item replacement directories so
+    // that Foundation APIs using atomic writes are not blocked by the sandbox.
+    let itemReplacementDirectories = Set(
+        writableDirectories.compactMap { try? fileSystem.itemReplacementDirectories(for: $0) }.flatMap { $0 }
+    )
+    for path in writableDirectories + itemReplacementDirectories.sorted() {
+        try mount(path, writable: true)
+    }
+
+    return arguments
+}
+#endif
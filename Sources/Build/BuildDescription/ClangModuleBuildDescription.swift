@@ -71,6 +71,9 @@ public final class ClangModuleBuildDescription {
     /// Path to the temporary directory for this target.
     var tempsPath: AbsolutePath
 
+    /// The source files of the target, which can be updated after planning with `updateSources(adding:removing:)`.
+    private var targetSources: Sources
+
     /// The directory containing derived sources of this target.
     ///
     /// These are the source files generated during the build.
@@ -132,6 +135,7 @@ public final class ClangModuleBuildDescription {
         self.clangTarget = clangTarget
         self.fileSystem = fileSystem
         self.target = target
+        self.targetSources = target.sources
         self.toolsVersion = toolsVersion
         self.buildParameters = buildParameters
         self.tempsPath = target.tempsPath(buildParameters)
@@ -188,12 +192,23 @@ public final class ClangModuleBuildDescription {
         }
     }
 
+    /// Adds and removes C-family source files of the target without replanning the build.
+    ///
+    /// - Returns: `true` if the sources of the target changed.
+    package func updateSources(adding addedFiles: [AbsolutePath], removing removedFiles: [AbsolutePath]) -> Bool {
+        self.targetSources.update(
+            adding: addedFiles,
+            removing: removedFiles,
+            validExtensions: SupportedLanguageExtension.clangTargetExtensions(toolsVersion: self.toolsVersion)
+        )
+    }
+
     /// An array of tuples containing filename, source, object and dependency path for each of the source in this target.
     public func compilePaths()
         throws -> [(filename: RelativePath, source: AbsolutePath, object: AbsolutePath, deps: AbsolutePath)]
     {
         let sources = [
-            target.sources.root: target.sources.relativePaths,
+            targetSources.root: targetSources.relativePaths,
             derivedSources.root: derivedSources.relativePaths,
             pluginDerivedSources.root: pluginDerivedSources.relativePaths
         ]
@@ -208,6 +223,14 @@ public final class ClangModuleBuildDescription {
         }
     }
 
+    /// The path of the split DWARF file the compiler emits next to the given object, if split DWARF is enabled.
+    func splitDWARFPath(forObject object: AbsolutePath) -> AbsolutePath? {
+        guard self.buildParameters.debuggingParameters.shouldSplitDWARF else {
+            return nil
+        }
+        return object.parentDirectory.appending(component: object.basenameWithoutExt + ".dwo")
+    }
+
     /// Determines the arguments needed to run `swift-symbolgraph-extract` for
     /// this module.
     package func symbolGraphExtractArguments() throws -> [String] {
@@ -323,6 +346,16 @@ public final class ClangModuleBuildDescription {
             }
         }
 
+        if self.buildParameters.debuggingParameters.shouldSplitDWARF {
+            args += ["-gsplit-dwarf"]
+        }
+        if self.buildParameters.debuggingParameters.shouldCompressDebugSections {
+            args += ["-gz"]
+        }
+        for mapping in self.buildParameters.debuggingParameters.pathPrefixMappings {
+            args += ["-ffile-prefix-map=\(mapping.argument)"]
+        }
+
         // Pass default include paths from the toolchain.
         for includeSearchPath in self.buildParameters.toolchain.includeSearchPaths {
             args += ["-I", includeSearchPath.pathString]
@@ -13,6 +13,7 @@
 import Basics
 import struct PackageGraph.ResolvedModule
 import struct PackageModel.Resource
+import struct PackageModel.Sources
 import struct PackageModel.ToolsVersion
 import struct SPMBuildCore.BuildToolPluginInvocationResult
 import struct SPMBuildCore.BuildParameters
@@ -64,7 +65,7 @@ public enum ModuleBuildDescription {
         }
     }
 
-    var target: ResolvedModule {
+    package var target: ResolvedModule {
         switch self {
         case .swift(let buildDescription):
             return buildDescription.target
@@ -119,6 +120,22 @@ public enum ModuleBuildDescription {
         }
     }
 
+    /// Adds and removes source files of the module without replanning the build, so that clients such as editors can
+    /// keep compiler arguments up to date while files are created and deleted. Files outside of the sources directory
+    /// of the module, or in a language the module can't compile, are ignored. Changes to the manifest, such as
+    /// excluded paths, are not taken into account and require a new build plan.
+    ///
+    /// - Returns: `true` if the sources of the module changed.
+    @discardableResult
+    package func updateSources(adding addedFiles: [AbsolutePath], removing removedFiles: [AbsolutePath]) -> Bool {
+        switch self {
+        case .swift(let buildDescription):
+            return buildDescription.updateSources(adding: addedFiles, removing: removedFiles)
+        case .clang(let buildDescription):
+            return buildDescription.updateSources(adding: addedFiles, removing: removedFiles)
+        }
+    }
+
     /// Determines the arguments needed to run `swift-symbolgraph-extract` for
     /// this module.
     package func symbolGraphExtractArguments() throws -> [String] {
@@ -128,3 +145,34 @@ public enum ModuleBuildDescription {
         }
     }
 }
+
+extension Sources {
+    /// Adds the files in `addedFiles` that are inside of the root and have one of the given extensions, and removes
+    /// the files in `removedFiles`.
+    ///
+    /// - Returns: `true` if the sources changed.
+    mutating func update(
+        adding addedFiles: [AbsolutePath],
+        removing removedFiles: [AbsolutePath],
+        validExtensions: Set<String>
+    ) -> Bool {
+        let removedPaths = Set(removedFiles.filter { $0.isDescendant(of: self.root) }.map { $0.relative(to: self.root) })
+        var relativePaths = self.relativePaths.filter { !removedPaths.contains($0) }
+        var knownPaths = Set(relativePaths)
+        for file in addedFiles where file.isDescendant(of: self.root) {
+            guard let fileExtension = file.extension, validExtensions.contains(fileExtension) else {
+                continue
+            }
+            let relativePath = file.relative(to: self.root)
+            if knownPaths.insert(relativePath).inserted {
+                relativePaths.append(relativePath)
+            }
+        }
+
+        guard relativePaths != self.relativePaths else {
+            return false
+        }
+        self.relativePaths = relativePaths.sorted(by: { $0.pathString < $1.pathString })
+        return true
+    }
+}
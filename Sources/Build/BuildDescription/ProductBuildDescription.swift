@@ -132,17 +132,139 @@ public final class ProductBuildDescription: SPMBuildCore.ProductBuildDescription
         }
     }
 
-    /// The arguments to the librarian to create a static library.
-    public func archiveArguments() throws -> [String] {
+    /// The arguments selecting the linker and its parallelism, if a linker other than the toolchain's default was
+    /// requested.
+    private var linkerSelectionArguments: [String] {
+        // Only ELF platforms allow choosing between these linkers.
+        guard let linker = self.buildParameters.linkingParameters.linker, self.buildParameters.triple.isLinux() else {
+            return []
+        }
+        // A linker selected by the Swift SDK or on the command line wins, and the thread options of the selected
+        // linker would be unknown to it.
+        guard !self.isLinkerSelectedByFlags else {
+            return []
+        }
+
+        var args = ["-use-ld=\(linker.rawValue)"]
+        if let threads = self.buildParameters.linkingParameters.linkerThreads {
+            switch linker {
+            case .lld:
+                args += ["-Xlinker", "--threads=\(threads)"]
+            case .mold:
+                args += ["-Xlinker", "--thread-count=\(threads)"]
+            case .gold:
+                args += ["-Xlinker", "--threads", "-Xlinker", "--thread-count=\(threads)"]
+            }
+        }
+        return args
+    }
+
+    /// Whether the Swift SDK's toolset or the user's flags select the linker themselves.
+    private var isLinkerSelectedByFlags: Bool {
+        let swiftCompilerFlags = self.buildParameters.toolchain.extraFlags.swiftCompilerFlags
+            + self.buildParameters.flags.swiftCompilerFlags
+        return swiftCompilerFlags.indices.contains { index in
+            let flag = swiftCompilerFlags[index]
+            if flag.hasPrefix("-use-ld=") {
+                return true
+            }
+            // `-Xclang-linker -fuse-ld=...`
+            return flag.hasPrefix("-fuse-ld=") && index > 0 && swiftCompilerFlags[index - 1] == "-Xclang-linker"
+        }
+    }
+
+    /// The path of the DWARF package of this product, if the split DWARF files of its objects should be packaged.
+    var dwarfPackagePath: AbsolutePath? {
+        get throws {
+            guard self.buildParameters.debuggingParameters.dwarfPackagerPath != nil else {
+                return nil
+            }
+            switch self.product.type {
+            case .executable, .snippet, .test, .library(.dynamic), .macro:
+                return try self.binaryPath.parentDirectory.appending(component: "\(self.binaryPath.basename).dwp")
+            case .library(.static), .library(.automatic), .plugin:
+                return nil
+            }
+        }
+    }
+
+    /// The arguments to package the split DWARF files referenced by the linked product into `dwarfPackagePath`.
+    func dwarfPackagingArguments() throws -> [String] {
+        guard let dwarfPackager = self.buildParameters.debuggingParameters.dwarfPackagerPath,
+              let dwarfPackagePath = try self.dwarfPackagePath
+        else {
+            throw InternalError("unexpectedly asked to package split DWARF for \(self.product.name)")
+        }
+        return try [dwarfPackager.pathString, "-e", self.binaryPath.pathString, "-o", dwarfPackagePath.pathString]
+    }
+
+    /// The kinds of librarians that static libraries can be created with.
+    private enum Librarian {
+        case link
+        case libtool
+        case ar
+    }
+
+    private var librarian: Librarian {
         let librarian = self.buildParameters.toolchain.librarianPath.pathString
         let triple = self.buildParameters.triple
         if triple.isWindows(), librarian.hasSuffix("link") || librarian.hasSuffix("link.exe") {
-            return try [librarian, "/LIB", "/OUT:\(binaryPath.pathString)", "@\(self.linkFileListPath.pathString)"]
+            return .link
         }
         if triple.isApple(), librarian.hasSuffix("libtool") {
-            return try [librarian, "-static", "-o", binaryPath.pathString, "@\(self.linkFileListPath.pathString)"]
+            return .libtool
+        }
+        return .ar
+    }
+
+    /// Whether this product is archived as a thin archive, which references its member objects in place.
+    ///
+    /// Updating a thin archive only rewrites its index and member list, and linkers read the objects directly
+    /// instead of extracting copies from the archive. Only ELF linkers reliably support them, so they are only used
+    /// for ELF targets archived with `ar`.
+    var usesThinArchive: Bool {
+        #if os(Windows)
+        // Archives are replaced through a shell, see `archiveArguments()`.
+        return false
+        #else
+        return self.product.type == .library(.static)
+            && self.buildParameters.linkingParameters.shouldUseThinArchives
+            && self.buildParameters.configuration == .debug
+            && self.buildParameters.triple.objectFormat == .elf
+            && self.librarian == .ar
+        #endif
+    }
+
+    /// The file whose existence records that the archive of this product may be a thin archive.
+    var thinArchiveMarkerPath: AbsolutePath {
+        self.tempsPath.appending("thin-archive")
+    }
+
+    /// The arguments to the librarian to create a static library.
+    public func archiveArguments() throws -> [String] {
+        let librarian = self.buildParameters.toolchain.librarianPath.pathString
+        let binaryPath = try self.binaryPath
+        switch self.librarian {
+        case .link:
+            return [librarian, "/LIB", "/OUT:\(binaryPath.pathString)", "@\(self.linkFileListPath.pathString)"]
+        case .libtool:
+            return [librarian, "-static", "-o", binaryPath.pathString, "@\(self.linkFileListPath.pathString)"]
+        case .ar:
+            let operation = self.usesThinArchive ? "crsT" : "crs"
+            let arguments = [librarian, operation, binaryPath.pathString, "@\(self.linkFileListPath.pathString)"]
+
+            // `ar` refuses to convert between regular and thin archives in place, so the archive is recreated
+            // whenever a thin archive is created, and once more after thin archives were turned off.
+            let markerPath = self.thinArchiveMarkerPath
+            if self.usesThinArchive {
+                return ["/bin/sh", "-c", #"rm -f "$0" && touch "$1" && shift && exec "$@""#]
+                    + [binaryPath.pathString, markerPath.pathString] + arguments
+            } else if self.fileSystem.exists(markerPath) {
+                return ["/bin/sh", "-c", #"rm -f "$0" "$1" && shift && exec "$@""#]
+                    + [binaryPath.pathString, markerPath.pathString] + arguments
+            }
+            return arguments
         }
-        return try [librarian, "crs", binaryPath.pathString, "@\(self.linkFileListPath.pathString)"]
     }
 
     /// The arguments to link and create this product.
@@ -337,6 +459,14 @@ public final class ProductBuildDescription: SPMBuildCore.ProductBuildDescription
         // building for Darwin in debug configuration.
         args += self.swiftASTs.flatMap { ["-Xlinker", "-add_ast_path", "-Xlinker", $0.pathString] }
 
+        // Select the linker ahead of toolchain and user flags, so that `-use-ld=` passed by a Swift SDK or with
+        // `-Xswiftc` takes precedence.
+        args += self.linkerSelectionArguments
+
+        if self.buildParameters.debuggingParameters.shouldCompressDebugSections {
+            args += ["-Xlinker", "--compress-debug-sections=zlib"]
+        }
+
         args += self.buildParameters.toolchain.extraFlags.swiftCompilerFlags
         // User arguments (from -Xswiftc) should follow generated arguments to allow user overrides
         args += self.buildParameters.flags.swiftCompilerFlags
@@ -52,6 +52,9 @@ public final class SwiftModuleBuildDescription {
     /// Path to the temporary directory for this target.
     let tempsPath: AbsolutePath
 
+    /// The source files of the target, which can be updated after planning with `updateSources(adding:removing:)`.
+    private var targetSources: Sources
+
     /// The directory containing derived sources of this target.
     ///
     /// These are the source files generated during the build.
@@ -86,7 +89,7 @@ public final class SwiftModuleBuildDescription {
 
     /// The list of all source files in the target, including the derived ones.
     public var sources: [AbsolutePath] {
-        self.target.sources.paths + self.derivedSources.paths + self.pluginDerivedSources.paths
+        self.targetSources.paths + self.derivedSources.paths + self.pluginDerivedSources.paths
     }
 
     public var sourcesFileListPath: AbsolutePath {
@@ -102,7 +105,7 @@ public final class SwiftModuleBuildDescription {
     /// depending on the build parameters used.
     public var objects: [AbsolutePath] {
         get throws {
-            let relativeSources = self.target.sources.relativePaths
+            let relativeSources = self.targetSources.relativePaths
                 + self.derivedSources.relativePaths
                 + self.pluginDerivedSources.relativePaths
             let ltoEnabled = self.buildParameters.linkingParameters.linkTimeOptimizationMode != nil
@@ -120,6 +123,21 @@ public final class SwiftModuleBuildDescription {
         return self.buildParameters.buildPath.appending(component: "Modules\(suffix)")
     }
 
+    /// The directory containing links to the modules of this module's dependencies, used as a search path
+    /// instead of `modulesPath` when isolated module search paths are enabled.
+    var dependencyModulesPath: AbsolutePath {
+        self.tempsPath.appending(component: "DependencyModules")
+    }
+
+    /// The path the compiler searches for Swift modules this module imports.
+    var moduleSearchPath: AbsolutePath {
+        if self.buildParameters.driverParameters.useIsolatedModuleSearchPaths {
+            return self.dependencyModulesPath
+        } else {
+            return self.modulesPath
+        }
+    }
+
     /// The path to the swiftmodule file after compilation.
     public var moduleOutputPath: AbsolutePath { // note: needs to be public because of sourcekit-lsp
         // If we're an executable and we're not allowing test targets to link against us, we hide the module.
@@ -150,6 +168,10 @@ public final class SwiftModuleBuildDescription {
     /// Any addition flags to be added. These flags are expected to be computed during build planning.
     var additionalFlags: [String] = []
 
+    /// Paths to the `.swiftmodule`s of the Swift modules this module depends on, directly or transitively.
+    /// These are expected to be computed during build planning.
+    var dependencyModulePaths: [AbsolutePath] = []
+
     /// Describes the purpose of a test target, including any special roles such as containing a list of discovered
     /// tests or serving as the manifest target which contains the main entry point.
     public enum TestTargetRole {
@@ -272,6 +294,7 @@ public final class SwiftModuleBuildDescription {
         self.swiftTarget = swiftTarget
         self.package = package
         self.target = target
+        self.targetSources = target.sources
         self.toolsVersion = toolsVersion
         self.buildParameters = buildParameters
 
@@ -619,6 +642,12 @@ public final class SwiftModuleBuildDescription {
             }
         }
 
+        // `-file-prefix-map` covers debug info and coverage mappings as well as `#file` and `#filePath`.
+        for mapping in self.buildParameters.debuggingParameters.pathPrefixMappings {
+            args += ["-file-prefix-map", mapping.argument]
+            args += ["-Xcc", "-ffile-prefix-map=\(mapping.argument)"]
+        }
+
         return args
     }
     
@@ -633,9 +662,8 @@ public final class SwiftModuleBuildDescription {
 
         // Include search paths determined during planning
         args += self.additionalFlags
-        // FIXME: only pass paths to the actual dependencies of the module
         // Include search paths for swift module dependencies.
-        args += ["-I", self.modulesPath.pathString]
+        args += ["-I", self.moduleSearchPath.pathString]
 
         // FIXME: Only include valid args
         // This condition should instead only include args which are known to be
@@ -738,17 +766,54 @@ public final class SwiftModuleBuildDescription {
         result.append(contentsOf: self.sources.map(\.pathString))
 
         result.append("-I")
-        result.append(self.modulesPath.pathString)
+        result.append(self.moduleSearchPath.pathString)
 
         result += try self.compileArguments()
         return result
     }
 
+    /// Adds and removes Swift source files of the target without replanning the build.
+    ///
+    /// - Returns: `true` if the sources of the target changed.
+    package func updateSources(adding addedFiles: [AbsolutePath], removing removedFiles: [AbsolutePath]) -> Bool {
+        self.targetSources.update(
+            adding: addedFiles,
+            removing: removedFiles,
+            validExtensions: SupportedLanguageExtension.swiftExtensions
+        )
+    }
+
     /// Returns true if ObjC compatibility header should be emitted.
     private var shouldEmitObjCCompatibilityHeader: Bool {
         self.buildParameters.triple.isDarwin() && self.target.type == .library
     }
 
+    /// Populates `dependencyModulesPath` with symbolic links to the modules in `dependencyModulePaths`, so that
+    /// the compiler only finds the modules this module declares a dependency on. The links are created during
+    /// planning and may point to modules that haven't been built yet.
+    func writeDependencyModulesDirectory() throws {
+        let directory = self.dependencyModulesPath
+        try self.fileSystem.createDirectory(directory, recursive: true)
+
+        var expected: [String: AbsolutePath] = [:]
+        for modulePath in self.dependencyModulePaths {
+            expected[modulePath.basename] = modulePath
+        }
+
+        // Remove links to modules which are no longer dependencies, so that they can't be imported by accident.
+        for entry in try self.fileSystem.getDirectoryContents(directory) where expected[entry] == nil {
+            try self.fileSystem.removeFileTree(directory.appending(component: entry))
+        }
+
+        for (name, modulePath) in expected {
+            let linkPath = directory.appending(component: name)
+            if self.fileSystem.isSymlink(linkPath) {
+                try self.fileSystem.removeFileTree(linkPath)
+            }
+            try self.fileSystem.createSymbolicLink(linkPath, pointingAt: modulePath, relative: false)
+        }
+    }
+
     func writeOutputFileMap() throws -> AbsolutePath {
         let path = self.tempsPath.appending("output-file-map.json")
         let masterDepsPath = self.tempsPath.appending("master.swiftdeps")
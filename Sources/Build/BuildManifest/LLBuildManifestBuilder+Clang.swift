@@ -80,11 +80,17 @@ extension LLBuildManifestBuilder {
             let objectFileNode: Node = .file(path.object)
             objectFileNodes.append(objectFileNode)
 
+            // Track the split DWARF file so that it is recreated if it goes missing.
+            var outputs = [objectFileNode]
+            if let splitDWARFPath = target.splitDWARFPath(forObject: path.object) {
+                outputs.append(.file(splitDWARFPath))
+            }
+
             self.manifest.addClangCmd(
                 name: path.object.pathString,
                 description: "Compiling \(target.target.name) \(path.filename)",
                 inputs: inputs + [.file(path.source)],
-                outputs: [objectFileNode],
+                outputs: outputs,
                 arguments: args,
                 dependencies: path.deps.pathString
             )
@@ -71,13 +71,23 @@ extension LLBuildManifestBuilder {
                 linkedBinaryNode = try .file(buildProduct.binaryPath)
             }
 
-            try self.manifest.addShellCmd(
-                name: cmdName,
-                description: "Linking \(buildProduct.binaryPath.prettyPath())",
-                inputs: inputs.map(Node.file),
-                outputs: [linkedBinaryNode],
-                arguments: try buildProduct.linkArguments()
-            )
+            if buildProduct.buildParameters.linkingParameters.maxConcurrentLinkJobs != nil {
+                try self.manifest.addLinkCmd(
+                    name: cmdName,
+                    description: "Linking \(buildProduct.binaryPath.prettyPath())",
+                    inputs: inputs.map(Node.file),
+                    outputs: [linkedBinaryNode],
+                    arguments: try buildProduct.linkArguments()
+                )
+            } else {
+                try self.manifest.addShellCmd(
+                    name: cmdName,
+                    description: "Linking \(buildProduct.binaryPath.prettyPath())",
+                    inputs: inputs.map(Node.file),
+                    outputs: [linkedBinaryNode],
+                    arguments: try buildProduct.linkArguments()
+                )
+            }
 
             if shouldCodeSign {
                 let basename = try buildProduct.binaryPath.basename
@@ -103,14 +113,31 @@ extension LLBuildManifestBuilder {
             }
         }
 
+        var productNodes = [finalProductNode]
+        if let dwarfPackagePath = try buildProduct.dwarfPackagePath {
+            let dwarfPackageNode = Node.file(dwarfPackagePath)
+            try self.manifest.addShellCmd(
+                name: "\(cmdName)-dwp",
+                description: "Packaging debug info for \(buildProduct.binaryPath.prettyPath())",
+                inputs: [finalProductNode],
+                outputs: [dwarfPackageNode],
+                arguments: buildProduct.dwarfPackagingArguments()
+            )
+            productNodes.append(dwarfPackageNode)
+        }
+
         self.manifest.addNode(output, toTarget: targetName)
         self.manifest.addPhonyCmd(
             name: output.name,
-            inputs: [finalProductNode],
+            inputs: productNodes,
             outputs: [output]
         )
 
-        if self.plan.graph.reachableProducts.contains(id: buildProduct.product.id) {
+        // Snippets that aren't linked when building everything are still compiled as part of their modules, and
+        // their products are linked on demand.
+        let isSkippedSnippet = buildProduct.product.type == .snippet
+            && !buildProduct.buildParameters.linkingParameters.shouldLinkSnippets
+        if self.plan.graph.reachableProducts.contains(id: buildProduct.product.id), !isSkippedSnippet {
             if buildProduct.product.type != .test {
                 self.addNode(output, toTarget: .main)
             }
@@ -19,7 +19,7 @@ import struct LLBuildManifest.LLBuildManifest
 import struct SPMBuildCore.BuildParameters
 import struct PackageGraph.ResolvedModule
 import protocol TSCBasic.FileSystem
-import func TSCBasic.topologicalSort
+import struct Basics.CompactGraph
 import struct Basics.Environment
 
 #if USE_IMPL_ONLY_IMPORTS
@@ -194,7 +194,7 @@ extension LLBuildManifestBuilder {
         let nodes = self.plan.targets.compactMap {
             ResolvedModule.Dependency.module($0.target, conditions: [])
         }
-        let allPackageDependencies = try topologicalSort(nodes, successors: { $0.dependencies })
+        let allPackageDependencies = try CompactGraph(roots: nodes, successors: { $0.dependencies }).topologicalSort()
         // Instantiate the inter-module dependency oracle which will cache commonly-scanned
         // modules across targets' Driver instances.
         let dependencyOracle = InterModuleDependencyOracle()
@@ -386,7 +386,7 @@ extension LLBuildManifestBuilder {
             moduleName: target.target.c99name,
             moduleAliases: target.target.moduleAliases,
             moduleOutputPath: target.moduleOutputPath,
-            importPath: target.modulesPath,
+            importPath: target.moduleSearchPath,
             tempsPath: target.tempsPath,
             objects: try target.objects,
             otherArguments: try target.compileArguments(),
@@ -434,10 +434,7 @@ extension LLBuildManifestBuilder {
 
             // Depend on the binary for executable targets.
             if target.type == .executable && !prepareForIndexing {
-                // FIXME: Optimize.
-                if let productDescription = try plan.productMap.values.first(where: {
-                    try $0.product.type == .executable && $0.product.executableModule.id == target.id
-                }) {
+                if let productDescription = plan.executableProductMap[target.id] {
                     try inputs.append(file: productDescription.binaryPath)
                 }
                 return
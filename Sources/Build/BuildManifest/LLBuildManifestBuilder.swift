@@ -62,6 +62,9 @@ public class LLBuildManifestBuilder {
     /// ObservabilityScope with which to emit diagnostics
     public let observabilityScope: ObservabilityScope
 
+    /// How long each command took in previous builds, in seconds.
+    let commandDurations: [LLBuildManifest.CmdName: Double]
+
     public internal(set) var manifest: LLBuildManifest = .init()
 
     /// Mapping from Swift compiler path to Swift get version files.
@@ -72,12 +75,14 @@ public class LLBuildManifestBuilder {
         _ plan: BuildPlan,
         disableSandboxForPluginCommands: Bool = false,
         fileSystem: any FileSystem,
-        observabilityScope: ObservabilityScope
+        observabilityScope: ObservabilityScope,
+        commandDurations: [LLBuildManifest.CmdName: Double] = [:]
     ) {
         self.plan = plan
         self.disableSandboxForPluginCommands = disableSandboxForPluginCommands
         self.fileSystem = fileSystem
         self.observabilityScope = observabilityScope
+        self.commandDurations = commandDurations
     }
 
     // MARK: - Generate Build Manifest
@@ -122,6 +127,10 @@ public class LLBuildManifestBuilder {
             try self.createProductCommand(description)
         }
 
+        if !self.commandDurations.isEmpty {
+            self.manifest.prioritizeCriticalPath(commandDurations: self.commandDurations)
+        }
+
         try LLBuildManifestWriter.write(self.manifest, at: path, fileSystem: self.fileSystem)
         return self.manifest
     }
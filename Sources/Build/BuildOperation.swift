@@ -122,6 +122,36 @@ package struct LLBuildSystemConfiguration {
         }
     }
 
+    /// The path of the durations of the commands of previous builds with the manifest, which is kept next to it so
+    /// that it only holds the commands of that manifest.
+    var commandDurationsPath: AbsolutePath {
+        self.manifestPath.parentDirectory.appending("\(self.manifestPath.basenameWithoutExt)-command-durations.json")
+    }
+
+    /// Returns the durations of the commands of previous builds in seconds, which are only used to order the build, so
+    /// failing to read them isn't an error.
+    func loadCommandDurations() -> [LLBuildManifest.CmdName: Double] {
+        (try? JSONDecoder.makeWithDefaults().decode(
+            path: self.commandDurationsPath,
+            fileSystem: self.fileSystem,
+            as: [LLBuildManifest.CmdName: Double].self
+        )) ?? [:]
+    }
+
+    /// Saves the durations of the commands of previous builds in seconds, which are only used to order the build, so
+    /// failing to write them isn't an error.
+    func saveCommandDurations(_ commandDurations: [LLBuildManifest.CmdName: Double]) {
+        do {
+            try JSONEncoder.makeWithDefaults(prettified: false).encode(
+                path: self.commandDurationsPath,
+                fileSystem: self.fileSystem,
+                commandDurations
+            )
+        } catch {
+            self.observabilityScope.emit(debug: "failed to save command durations", underlyingError: error)
+        }
+    }
+
     func buildDescriptionPath(for description: BuildParameters.Destination) -> AbsolutePath {
         switch description {
         case .host: self.toolsBuildParameters.buildDescriptionPath
@@ -531,6 +561,7 @@ public final class BuildOperation: PackageStructureDelegate, SPMBuildCore.BuildS
             duration: duration,
             subsetDescriptor: subsetDescriptor
         )
+        self.saveCommandDurations(progressTracker.commandDurations)
         guard success else { throw Diagnostics.fatalError }
 
         // Create backwards-compatibility symlink to old build path.
@@ -918,6 +949,15 @@ public final class BuildOperation: PackageStructureDelegate, SPMBuildCore.BuildS
         return (buildSystem: llbuildSystem, tracker: progressTracker)
     }
 
+    /// Merges the durations of the commands that ran into the ones of previous builds, from which the manifest builder
+    /// computes the critical path of the next build.
+    private func saveCommandDurations(_ durations: [LLBuildManifest.CmdName: Double]) {
+        guard !durations.isEmpty else {
+            return
+        }
+        self.config.saveCommandDurations(self.config.loadCommandDurations().merging(durations) { $1 })
+    }
+
     /// Runs any prebuild commands associated with the given list of plugin invocation results, in order, and returns the
     /// results of running those prebuild commands.
     private func runPrebuildCommands(for pluginResults: [BuildToolPluginInvocationResult]) throws -> [PrebuildCommandResult] {
@@ -1033,49 +1073,71 @@ extension BuildOperation {
             components: "..", "plugin-tools.yaml"
         )
 
-        // FIXME: It should be possible to share database between plugin tools
-        // and regular builds. To make that happen we need to refactor
-        // `buildPackageStructure` to recognize the split.
+        // FIXME: It should be possible to share the database between plugin tools and regular builds. Tools are
+        // built from within the package structure command, while the regular build holds an llbuild engine on
+        // `build.db`, and the tools manifest lacks the plugin invocation results of the regular manifest, so the two
+        // would invalidate each other's commands. To share it, tools have to be built outside of
+        // `buildPackageStructure`, as part of the regular manifest.
         config.databasePath = config.scratchDirectory.appending("plugin-tools.db")
 
-        config.buildDescriptionPath = config.buildPath(for: .host).appending(
-            component: "plugin-tools-description.json"
-        )
+        // Planning and starting llbuild are only necessary if at least one plugin uses a tool that has to be
+        // built from source, plugins that only vend prebuilt binaries don't pay for it.
+        var toolsBuild: (plan: BuildPlan, buildSystem: SPMLLBuild.BuildSystem)?
+        func makeToolsBuild() throws -> (plan: BuildPlan, buildSystem: SPMLLBuild.BuildSystem) {
+            if let toolsBuild {
+                return toolsBuild
+            }
 
-        let buildPlan = try BuildPlan(
-            destinationBuildParameters: config.destinationBuildParameters,
-            toolsBuildParameters: config.toolsBuildParameters,
-            graph: graph,
-            additionalFileRules: [],
-            buildToolPluginInvocationResults: [:],
-            prebuildCommandResults: [:],
-            disableSandbox: false,
-            fileSystem: config.fileSystem,
-            observabilityScope: config.observabilityScope
-        )
+            let buildPlan = try BuildPlan(
+                destinationBuildParameters: config.destinationBuildParameters,
+                toolsBuildParameters: config.toolsBuildParameters,
+                graph: graph,
+                additionalFileRules: [],
+                buildToolPluginInvocationResults: [:],
+                prebuildCommandResults: [:],
+                disableSandbox: false,
+                fileSystem: config.fileSystem,
+                observabilityScope: config.observabilityScope
+            )
 
-        let (buildDescription, _) = try BuildDescription.create(
-            from: buildPlan,
-            using: config,
-            disableSandboxForPluginCommands: false
-        )
+            // The description is only needed by the build system to execute custom commands, it's not persisted
+            // because nothing is going to load it back from disk.
+            let (buildDescription, _) = try BuildDescription.create(
+                from: buildPlan,
+                using: config,
+                disableSandboxForPluginCommands: false,
+                persistDescription: false
+            )
 
-        let (buildSystem, _) = try self.createBuildSystem(
-            buildDescription: buildDescription,
-            config: config
-        )
+            let (buildSystem, _) = try self.createBuildSystem(
+                buildDescription: buildDescription,
+                config: config
+            )
+
+            toolsBuild = (buildPlan, buildSystem)
+            return (buildPlan, buildSystem)
+        }
 
+        // The same tool is frequently used by multiple plugins, make sure that each is only built once.
+        var builtTools: [String: AbsolutePath?] = [:]
         func buildToolBuilder(_ name: String, _ path: RelativePath) throws -> AbsolutePath? {
+            if let builtTool = builtTools[name] {
+                return builtTool
+            }
+
+            let (buildPlan, buildSystem) = try makeToolsBuild()
             let llbuildTarget = try self.computeLLBuildTargetName(for: .product(name, for: .host))
             let success = buildSystem.build(target: llbuildTarget)
 
-            if !success {
-                return nil
+            var result: AbsolutePath? = nil
+            if success {
+                result = try buildPlan.buildProducts.first {
+                    $0.product.name == name && $0.buildParameters.destination == .host
+                }?.binaryPath
             }
 
-            return try buildPlan.buildProducts.first {
-                $0.product.name == name && $0.buildParameters.destination == .host
-            }?.binaryPath
+            builtTools[name] = .some(result)
+            return result
         }
 
         for (_, plugins) in pluginsPerModule {
@@ -1106,27 +1168,37 @@ extension BuildDescription {
     static func create(
         from plan: BuildPlan,
         using config: LLBuildSystemConfiguration,
-        disableSandboxForPluginCommands: Bool
+        disableSandboxForPluginCommands: Bool,
+        persistDescription: Bool = true
     ) throws -> (BuildDescription, LLBuildManifest) {
         let fileSystem = config.fileSystem
 
         // Generate the llbuild manifest.
+        let commandDurations = config.loadCommandDurations()
         let llbuild = LLBuildManifestBuilder(
             plan,
             disableSandboxForPluginCommands: disableSandboxForPluginCommands,
             fileSystem: fileSystem,
-            observabilityScope: config.observabilityScope
+            observabilityScope: config.observabilityScope,
+            commandDurations: commandDurations
         )
         let buildManifest = plan.destinationBuildParameters.prepareForIndexing
             ? try llbuild.generatePrepareManifest(at: config.manifestPath)
             : try llbuild.generateManifest(at: config.manifestPath)
 
+        // Forget the durations of the commands that are no longer in the manifest, like the ones of removed modules.
+        let currentCommandDurations = commandDurations.filter { buildManifest.commands[$0.key] != nil }
+        if currentCommandDurations.count != commandDurations.count {
+            config.saveCommandDurations(currentCommandDurations)
+        }
+
         let swiftCommands = llbuild.manifest.getCmdToolMap(kind: SwiftCompilerTool.self)
         let swiftFrontendCommands = llbuild.manifest.getCmdToolMap(kind: SwiftFrontendTool.self)
         let testDiscoveryCommands = llbuild.manifest.getCmdToolMap(kind: TestDiscoveryTool.self)
         let testEntryPointCommands = llbuild.manifest.getCmdToolMap(kind: TestEntryPointTool.self)
         let copyCommands = llbuild.manifest.getCmdToolMap(kind: CopyTool.self)
         let writeCommands = llbuild.manifest.getCmdToolMap(kind: WriteAuxiliaryFile.self)
+        let linkCommands = llbuild.manifest.getCmdToolMap(kind: LinkTool.self)
 
         // Create the build description.
         let buildDescription = try BuildDescription(
@@ -1137,17 +1209,20 @@ extension BuildDescription {
             testEntryPointCommands: testEntryPointCommands,
             copyCommands: copyCommands,
             writeCommands: writeCommands,
+            linkCommands: linkCommands,
             pluginDescriptions: plan.pluginDescriptions,
             traitConfiguration: config.traitConfiguration
         )
-        try fileSystem.createDirectory(
-            config.buildDescriptionPath.parentDirectory,
-            recursive: true
-        )
-        try buildDescription.write(
-            fileSystem: fileSystem,
-            path: config.buildDescriptionPath
-        )
+        if persistDescription {
+            try fileSystem.createDirectory(
+                config.buildDescriptionPath.parentDirectory,
+                recursive: true
+            )
+            try buildDescription.write(
+                fileSystem: fileSystem,
+                path: config.buildDescriptionPath
+            )
+        }
         return (buildDescription, buildManifest)
     }
 }
@@ -25,7 +25,7 @@ import class PackageModel.SwiftModule
 import class PackageModel.SystemLibraryModule
 import struct SPMBuildCore.BuildParameters
 import struct SPMBuildCore.ExecutableInfo
-import func TSCBasic.topologicalSort
+import struct Basics.CompactGraph
 
 extension BuildPlan {
     /// Plan a product.
@@ -143,16 +143,16 @@ extension BuildPlan {
         }
 
         // For test targets, we need to consider the first level of transitive dependencies since the first level is always test targets.
-        let topLevelDependencies: [PackageModel.Module]
+        let topLevelDependencies: Set<PackageModel.Module>
         if product.type == .test {
-            topLevelDependencies = product.modules.flatMap { $0.underlying.dependencies }.compactMap {
+            topLevelDependencies = Set(product.modules.flatMap { $0.underlying.dependencies }.compactMap {
                 switch $0 {
                 case .product:
                     return nil
                 case .module(let target, _):
                     return target
                 }
-            }
+            })
         } else {
             topLevelDependencies = []
         }
@@ -165,7 +165,7 @@ extension BuildPlan {
 
         // Sort the product targets in topological order.
         let nodes: [ResolvedModule.Dependency] = product.modules.map { .module($0, conditions: []) }
-        let allTargets = try topologicalSort(nodes, successors: { dependency in
+        let allTargets = try CompactGraph(roots: nodes, successors: { dependency in
             switch dependency {
             // Include all the dependencies of a target.
             case .module(let target, _):
@@ -201,7 +201,7 @@ extension BuildPlan {
                     return []
                 }
             }
-        })
+        }).topologicalSort()
 
         // Create empty arrays to collect our results.
         var linkLibraries = [ResolvedProduct]()
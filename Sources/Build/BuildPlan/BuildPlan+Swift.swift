@@ -54,9 +54,15 @@ extension BuildPlan {
                     "-I", target.path.pathString
                 ]
             default:
-                break
+                if case let .swift(target)? = targetMap[dependency.id] {
+                    swiftTarget.dependencyModulePaths.append(target.moduleOutputPath)
+                }
             }
         }
+
+        if swiftTarget.buildParameters.driverParameters.useIsolatedModuleSearchPaths {
+            try swiftTarget.writeDependencyModulesDirectory()
+        }
     }
 
 }
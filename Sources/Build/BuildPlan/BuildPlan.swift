@@ -201,6 +201,9 @@ public class BuildPlan: SPMBuildCore.BuildPlan {
     /// The product build description map.
     public let productMap: [ResolvedProduct.ID: ProductBuildDescription]
 
+    /// The executable product build descriptions, keyed by the ID of their executable module.
+    let executableProductMap: [ResolvedModule.ID: ProductBuildDescription]
+
     /// The plugin descriptions. Plugins are represented in the package graph
     /// as targets, but they are not directly included in the build graph.
     public let pluginDescriptions: [PluginBuildDescription]
@@ -228,6 +231,12 @@ public class BuildPlan: SPMBuildCore.BuildPlan {
     /// Cache for pkgConfig flags.
     private var pkgConfigCache = [SystemLibraryModule: (cFlags: [String], libs: [String])]()
 
+    /// Cache for pkgConfig results that persists across builds.
+    private lazy var persistentPkgConfigCache = PkgConfigCache(
+        path: self.destinationBuildParameters.dataPath.appending(component: "pkg-config-cache.json"),
+        fileSystem: self.fileSystem
+    )
+
     /// Cache for library information.
     private var externalLibrariesCache = [BinaryModule: [LibraryInfo]]()
 
@@ -316,6 +325,17 @@ public class BuildPlan: SPMBuildCore.BuildPlan {
                 }
             }
 
+        // Index the products by the modules they contain, so that plugin descriptions don't have to
+        // scan every product of their package.
+        var productsByModule = [ResolvedModule.ID: [ResolvedProduct]]()
+        for package in graph.packages {
+            for product in package.products {
+                for module in product.modules {
+                    productsByModule[module.id, default: []].append(product)
+                }
+            }
+        }
+
         // Create build target description for each target which we need to plan.
         // Plugin targets are noted, since they need to be compiled, but they do
         // not get directly incorporated into the build description that will be
@@ -420,7 +440,7 @@ public class BuildPlan: SPMBuildCore.BuildPlan {
                 }
                 try pluginDescriptions.append(PluginBuildDescription(
                     module: target,
-                    products: package.products.filter { $0.modules.contains(id: target.id) },
+                    products: productsByModule[target.id] ?? [],
                     package: package,
                     toolsVersion: toolsVersion,
                     fileSystem: fileSystem
@@ -471,6 +491,13 @@ public class BuildPlan: SPMBuildCore.BuildPlan {
         }
 
         self.productMap = productMap.mapValues(\.buildDescription)
+        self.executableProductMap = productMap.values
+            .filter { $0.product.type == .executable }
+            .reduce(into: [ResolvedModule.ID: ProductBuildDescription]()) {
+                if let executableModule = try? $1.product.executableModule {
+                    $0[executableModule.id] = $1.buildDescription
+                }
+            }
         self.targetMap = targetMap
         self.pluginDescriptions = pluginDescriptions
 
@@ -619,11 +646,10 @@ public class BuildPlan: SPMBuildCore.BuildPlan {
         } else {
             self.pkgConfigCache[target] = ([], [])
         }
-        let results = try pkgConfigArgs(
+        let results = try self.persistentPkgConfigCache.pkgConfigArgs(
             for: target,
             pkgConfigDirectories: self.destinationBuildParameters.pkgConfigDirectories,
             sdkRootPath: self.destinationBuildParameters.toolchain.sdkRootPath,
-            fileSystem: self.fileSystem,
             observabilityScope: self.observabilityScope
         )
         var ret: [(cFlags: [String], libs: [String])] = []
@@ -417,3 +417,47 @@ final class CopyCommand: CustomLLBuildCommand {
         return true
     }
 }
+
+final class LinkCommand: CustomLLBuildCommand {
+    override func getSignature(_ command: SPMLLBuild.Command) -> [UInt8] {
+        // Relink when the link arguments change, like llbuild does for shell commands.
+        guard let tool = self.context.buildDescription?.linkCommands[command.name] else {
+            return []
+        }
+        return Array(tool.arguments.joined(separator: "\0").utf8)
+    }
+
+    override func execute(
+        _ command: SPMLLBuild.Command,
+        _: SPMLLBuild.BuildSystemCommandInterface
+    ) -> Bool {
+        do {
+            // This tool will never run without the build description.
+            guard let buildDescription = self.context.buildDescription else {
+                throw InternalError("unknown build description")
+            }
+            guard let tool = buildDescription.linkCommands[command.name] else {
+                throw StringError("command \(command.name) not registered")
+            }
+
+            // Wait for one of the link jobs, which blocks this llbuild lane, but lets the other ones build what
+            // doesn't need to be linked.
+            self.context.linkJobsSemaphore?.wait()
+            defer { self.context.linkJobsSemaphore?.signal() }
+
+            self.context.inProcessCommandDelegate?.commandWillRun(command)
+            let result = try AsyncProcess.popen(arguments: tool.arguments)
+            try self.context.inProcessCommandDelegate?.commandHadOutput(
+                command,
+                output: result.output.get() + result.stderrOutput.get()
+            )
+            guard result.exitStatus == .terminated(code: 0) else {
+                throw StringError("linking failed with \(result.exitStatus)")
+            }
+        } catch {
+            self.context.observabilityScope.emit(error)
+            return false
+        }
+        return true
+    }
+}
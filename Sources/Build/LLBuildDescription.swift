@@ -42,6 +42,9 @@ public struct BuildDescription: Codable {
     /// The map of write commands.
     let writeCommands: [LLBuildManifest.CmdName: WriteAuxiliaryFile]
 
+    /// The map of link commands that are limited in how many run at once.
+    let linkCommands: [LLBuildManifest.CmdName: LinkTool]
+
     /// A flag that indicates this build should perform a check for whether targets only import
     /// their explicitly-declared dependencies
     let explicitTargetDependencyImportCheckingMode: BuildParameters.TargetDependencyImportCheckingMode
@@ -72,6 +75,7 @@ public struct BuildDescription: Codable {
         testEntryPointCommands: [LLBuildManifest.CmdName: TestEntryPointTool],
         copyCommands: [LLBuildManifest.CmdName: CopyTool],
         writeCommands: [LLBuildManifest.CmdName: WriteAuxiliaryFile],
+        linkCommands: [LLBuildManifest.CmdName: LinkTool] = [:],
         pluginDescriptions: [PluginBuildDescription]
     ) throws {
         try self.init(
@@ -82,6 +86,7 @@ public struct BuildDescription: Codable {
             testEntryPointCommands: testEntryPointCommands,
             copyCommands: copyCommands,
             writeCommands: writeCommands,
+            linkCommands: linkCommands,
             pluginDescriptions: pluginDescriptions,
             traitConfiguration: nil
         )
@@ -95,6 +100,7 @@ public struct BuildDescription: Codable {
         testEntryPointCommands: [LLBuildManifest.CmdName: TestEntryPointTool],
         copyCommands: [LLBuildManifest.CmdName: CopyTool],
         writeCommands: [LLBuildManifest.CmdName: WriteAuxiliaryFile],
+        linkCommands: [LLBuildManifest.CmdName: LinkTool],
         pluginDescriptions: [PluginBuildDescription],
         traitConfiguration: TraitConfiguration?
     ) throws {
@@ -104,6 +110,7 @@ public struct BuildDescription: Codable {
         self.testEntryPointCommands = testEntryPointCommands
         self.copyCommands = copyCommands
         self.writeCommands = writeCommands
+        self.linkCommands = linkCommands
         self.explicitTargetDependencyImportCheckingMode = plan.destinationBuildParameters.driverParameters
             .explicitTargetDependencyImportCheckingMode
         self.traitConfiguration = traitConfiguration
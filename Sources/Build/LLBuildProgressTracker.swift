@@ -76,6 +76,13 @@ public final class BuildExecutionContext {
 
     let observabilityScope: ObservabilityScope
 
+    /// Limits the number of link commands that run at once, `nil` if they aren't limited.
+    let linkJobsSemaphore: DispatchSemaphore?
+
+    /// Receives the events of in-process commands that llbuild doesn't know about, set by the progress tracker of the
+    /// build.
+    weak var inProcessCommandDelegate: InProcessCommandDelegate?
+
     public init(
         productsBuildParameters: BuildParameters,
         toolsBuildParameters: BuildParameters,
@@ -92,6 +99,9 @@ public final class BuildExecutionContext {
         self.observabilityScope = observabilityScope
         self.packageStructureDelegate = packageStructureDelegate
         self.buildErrorAdviceProvider = buildErrorAdviceProvider
+        self.linkJobsSemaphore = productsBuildParameters.linkingParameters.maxConcurrentLinkJobs.map {
+            DispatchSemaphore(value: $0)
+        }
     }
 
     // MARK: - Private
@@ -134,6 +144,15 @@ public protocol PackageStructureDelegate {
     func packageStructureChanged() -> Bool
 }
 
+/// Receives the events of in-process commands that llbuild doesn't know about.
+protocol InProcessCommandDelegate: AnyObject {
+    /// The command is about to run its process, after waiting for the resources it needs.
+    func commandWillRun(_ command: SPMLLBuild.Command)
+
+    /// The process that the command ran produced `output`.
+    func commandHadOutput(_ command: SPMLLBuild.Command, output: [UInt8])
+}
+
 /// Convenient llbuild build system delegate implementation
 final class LLBuildProgressTracker: LLBuildBuildSystemDelegate, SwiftCompilerOutputParserDelegate {
     private let outputStream: ThreadSafeOutputByteStream
@@ -153,6 +172,12 @@ final class LLBuildProgressTracker: LLBuildBuildSystemDelegate, SwiftCompilerOut
     /// Buffer to accumulate non-swift output until command is finished
     private var nonSwiftMessageBuffers: [String: [UInt8]] = [:]
 
+    /// Start times of the running commands keyed by llbuild command name.
+    private var commandStartTimes: [String: DispatchTime] = [:]
+
+    /// Durations in seconds of the finished commands keyed by llbuild command name.
+    private var finishedCommandDurations: [String: Double] = [:]
+
     /// The build execution context.
     private let buildExecutionContext: BuildExecutionContext
 
@@ -185,6 +210,7 @@ final class LLBuildProgressTracker: LLBuildBuildSystemDelegate, SwiftCompilerOut
                 self.delegate?.buildSystem(self.buildSystem, didUpdateTaskProgress: progressText)
             }
         }
+        buildExecutionContext.inProcessCommandDelegate = self
     }
 
     // MARK: llbuildSwift.BuildSystemDelegate
@@ -205,6 +231,8 @@ final class LLBuildProgressTracker: LLBuildBuildSystemDelegate, SwiftCompilerOut
             InProcessTool(self.buildExecutionContext, type: CopyCommand.self)
         case WriteAuxiliaryFile.name:
             InProcessTool(self.buildExecutionContext, type: WriteAuxiliaryFileCommand.self)
+        case LinkTool.name:
+            InProcessTool(self.buildExecutionContext, type: LinkCommand.self)
         default:
             nil
         }
@@ -250,12 +278,21 @@ final class LLBuildProgressTracker: LLBuildBuildSystemDelegate, SwiftCompilerOut
     }
 
     func commandStarted(_ command: SPMLLBuild.Command) {
+        let startTime = DispatchTime.now()
+        self.queue.async {
+            self.commandStartTimes[command.name] = startTime
+        }
+
         guard command.shouldShowStatus else { return }
 
         self.queue.async {
             self.delegate?.buildSystem(self.buildSystem, didStartCommand: BuildSystemCommand(command))
             if self.logLevel.isVerbose {
-                self.outputStream.send("\(command.verboseDescription)\n")
+                // Link commands run in-process, so llbuild only knows their description rather than their command line.
+                let verboseDescription = self.buildExecutionContext.buildDescription?.linkCommands[command.name].map {
+                    $0.arguments.map { $0.spm_shellEscaped() }.joined(separator: " ")
+                } ?? command.verboseDescription
+                self.outputStream.send("\(verboseDescription)\n")
                 self.outputStream.flush()
             }
         }
@@ -266,6 +303,14 @@ final class LLBuildProgressTracker: LLBuildBuildSystemDelegate, SwiftCompilerOut
     }
 
     func commandFinished(_ command: SPMLLBuild.Command, result: CommandResult) {
+        let finishTime = DispatchTime.now()
+        self.queue.async {
+            let startTime = self.commandStartTimes.removeValue(forKey: command.name)
+            if result == .succeeded, let duration = startTime?.distance(to: finishTime).nanoseconds() {
+                self.finishedCommandDurations[command.name] = Double(duration) / 1e9
+            }
+        }
+
         guard command.shouldShowStatus else { return }
         guard !self.swiftParsers.keys.contains(command.name) else { return }
 
@@ -485,6 +530,11 @@ final class LLBuildProgressTracker: LLBuildBuildSystemDelegate, SwiftCompilerOut
         }
     }
 
+    /// How long each command that ran so far took, in seconds.
+    var commandDurations: [String: Double] {
+        self.queue.sync { self.finishedCommandDurations }
+    }
+
     // MARK: Private
 
     private func updateProgress() {
@@ -661,3 +711,24 @@ extension BuildSystemCommand {
         )
     }
 }
+
+extension LLBuildProgressTracker: InProcessCommandDelegate {
+    func commandWillRun(_ command: SPMLLBuild.Command) {
+        // The recorded duration of the command only covers its process, not the time it waited to run it.
+        let startTime = DispatchTime.now()
+        self.queue.async {
+            self.commandStartTimes[command.name] = startTime
+        }
+    }
+
+    func commandHadOutput(_ command: SPMLLBuild.Command, output: [UInt8]) {
+        guard command.shouldShowStatus, !output.isEmpty else { return }
+
+        // Like the buffered output of shell commands, this is printed once the process finished.
+        self.queue.async {
+            self.progressAnimation.clear()
+            self.outputStream.send(output)
+            self.outputStream.flush()
+        }
+    }
+}
@@ -22,7 +22,7 @@ import TSCUtility
 import Workspace
 
 extension SwiftPackageCommand {
-    struct AddDependency: SwiftCommand {
+    struct AddDependency: ManifestEditCommand {
         package static let configuration = CommandConfiguration(
             abstract: "Add a package dependency to the manifest")
 
@@ -50,32 +50,7 @@ extension SwiftPackageCommand {
         @Option(help: "Specify upper bound on the package version range (exclusive)")
         var to: Version?
 
-        func run(_ swiftCommandState: SwiftCommandState) throws {
-            let workspace = try swiftCommandState.getActiveWorkspace()
-
-            guard let packagePath = try swiftCommandState.getWorkspaceRoot().packages.first else {
-                throw StringError("unknown package")
-            }
-
-            // Load the manifest file
-            let fileSystem = workspace.fileSystem
-            let manifestPath = packagePath.appending("Package.swift")
-            let manifestContents: ByteString
-            do {
-                manifestContents = try fileSystem.readFileContents(manifestPath)
-            } catch {
-                throw StringError("cannot find package manifest in \(manifestPath)")
-            }
-
-            // Parse the manifest.
-            let manifestSyntax = manifestContents.withData { data in
-                data.withUnsafeBytes { buffer in
-                    buffer.withMemoryRebound(to: UInt8.self) { buffer in
-                        Parser.parse(source: buffer)
-                    }
-                }
-            }
-
+        func manifestEdit(_ swiftCommandState: SwiftCommandState) throws -> ManifestEdit {
             let identity = PackageIdentity(url: .init(dependency))
 
             // Collect all of the possible version requirements.
@@ -140,17 +115,7 @@ extension SwiftPackageCommand {
                 traits: []
             )
 
-            let editResult = try AddPackageDependency.addPackageDependency(
-                packageDependency,
-                to: manifestSyntax
-            )
-
-            try editResult.applyEdits(
-                to: fileSystem,
-                manifest: manifestSyntax,
-                manifestPath: manifestPath,
-                verbose: !globalOptions.logging.quiet
-            )
+            return .addPackageDependency(packageDependency)
         }
     }
 }
@@ -22,7 +22,7 @@ import TSCUtility
 import Workspace
 
 extension SwiftPackageCommand {
-    struct AddProduct: SwiftCommand {
+    struct AddProduct: ManifestEditCommand {
         /// The package product type used for the command-line. This is a
         /// subset of `ProductType` that expands out the library types.
         enum CommandProductType: String, Codable, ExpressibleByArgument {
@@ -51,32 +51,7 @@ extension SwiftPackageCommand {
         )
         var targets: [String] = []
 
-        func run(_ swiftCommandState: SwiftCommandState) throws {
-            let workspace = try swiftCommandState.getActiveWorkspace()
-
-            guard let packagePath = try swiftCommandState.getWorkspaceRoot().packages.first else {
-                throw StringError("unknown package")
-            }
-
-            // Load the manifest file
-            let fileSystem = workspace.fileSystem
-            let manifestPath = packagePath.appending("Package.swift")
-            let manifestContents: ByteString
-            do {
-                manifestContents = try fileSystem.readFileContents(manifestPath)
-            } catch {
-                throw StringError("cannot find package manifest in \(manifestPath)")
-            }
-
-            // Parse the manifest.
-            let manifestSyntax = manifestContents.withData { data in
-                data.withUnsafeBytes { buffer in
-                    buffer.withMemoryRebound(to: UInt8.self) { buffer in
-                        Parser.parse(source: buffer)
-                    }
-                }
-            }
-
+        func manifestEdit(_ swiftCommandState: SwiftCommandState) throws -> ManifestEdit {
             // Map the product type.
             let type: ProductType = switch self.type {
             case .executable: .executable
@@ -92,17 +67,7 @@ extension SwiftPackageCommand {
                 targets: targets
             )
 
-            let editResult = try PackageModelSyntax.AddProduct.addProduct(
-                product,
-                to: manifestSyntax
-            )
-
-            try editResult.applyEdits(
-                to: fileSystem,
-                manifest: manifestSyntax,
-                manifestPath: manifestPath,
-                verbose: !globalOptions.logging.quiet
-            )
+            return .addProduct(product)
         }
     }
 }
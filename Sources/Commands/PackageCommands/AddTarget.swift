@@ -24,7 +24,7 @@ import Workspace
 extension AddTarget.TestHarness: ExpressibleByArgument { }
 
 extension SwiftPackageCommand {
-    struct AddTarget: SwiftCommand {
+    struct AddTarget: ManifestEditCommand {
         /// The type of target that can be specified on the command line.
         enum TargetType: String, Codable, ExpressibleByArgument {
             case library
@@ -63,32 +63,7 @@ extension SwiftPackageCommand {
         @Option(help: "The testing library to use when generating test targets, which can be one of 'xctest', 'swift-testing', or 'none'")
         var testingLibrary: PackageModelSyntax.AddTarget.TestHarness = .default
 
-        func run(_ swiftCommandState: SwiftCommandState) throws {
-            let workspace = try swiftCommandState.getActiveWorkspace()
-
-            guard let packagePath = try swiftCommandState.getWorkspaceRoot().packages.first else {
-                throw StringError("unknown package")
-            }
-
-            // Load the manifest file
-            let fileSystem = workspace.fileSystem
-            let manifestPath = packagePath.appending("Package.swift")
-            let manifestContents: ByteString
-            do {
-                manifestContents = try fileSystem.readFileContents(manifestPath)
-            } catch {
-                throw StringError("cannot find package manifest in \(manifestPath)")
-            }
-
-            // Parse the manifest.
-            let manifestSyntax = manifestContents.withData { data in
-                data.withUnsafeBytes { buffer in
-                    buffer.withMemoryRebound(to: UInt8.self) { buffer in
-                        Parser.parse(source: buffer)
-                    }
-                }
-            }
-
+        func manifestEdit(_ swiftCommandState: SwiftCommandState) throws -> ManifestEdit {
             // Map the target type.
             let type: TargetDescription.TargetKind = switch self.type {
                 case .library: .regular
@@ -112,21 +87,13 @@ extension SwiftPackageCommand {
                 checksum: checksum
             )
 
-            let editResult = try PackageModelSyntax.AddTarget.addTarget(
+            return try .addTarget(
                 target,
-                to: manifestSyntax,
                 configuration: .init(testHarness: testingLibrary),
                 installedSwiftPMConfiguration: swiftCommandState
                   .getHostToolchain()
                   .installedSwiftPMConfiguration
             )
-
-            try editResult.applyEdits(
-                to: fileSystem,
-                manifest: manifestSyntax,
-                manifestPath: manifestPath,
-                verbose: !globalOptions.logging.quiet
-            )
         }
     }
 }
@@ -22,7 +22,7 @@ import TSCUtility
 import Workspace
 
 extension SwiftPackageCommand {
-    struct AddTargetDependency: SwiftCommand {
+    struct AddTargetDependency: ManifestEditCommand {
         package static let configuration = CommandConfiguration(
             abstract: "Add a new target dependency to the manifest")
 
@@ -38,32 +38,7 @@ extension SwiftPackageCommand {
         @Option(help: "The package in which the dependency resides")
         var package: String?
 
-        func run(_ swiftCommandState: SwiftCommandState) throws {
-            let workspace = try swiftCommandState.getActiveWorkspace()
-
-            guard let packagePath = try swiftCommandState.getWorkspaceRoot().packages.first else {
-                throw StringError("unknown package")
-            }
-
-            // Load the manifest file
-            let fileSystem = workspace.fileSystem
-            let manifestPath = packagePath.appending("Package.swift")
-            let manifestContents: ByteString
-            do {
-                manifestContents = try fileSystem.readFileContents(manifestPath)
-            } catch {
-                throw StringError("cannot find package manifest in \(manifestPath)")
-            }
-
-            // Parse the manifest.
-            let manifestSyntax = manifestContents.withData { data in
-                data.withUnsafeBytes { buffer in
-                    buffer.withMemoryRebound(to: UInt8.self) { buffer in
-                        Parser.parse(source: buffer)
-                    }
-                }
-            }
-
+        func manifestEdit(_ swiftCommandState: SwiftCommandState) throws -> ManifestEdit {
             let dependency: TargetDescription.Dependency
             if let package {
                 dependency = .product(name: dependencyName, package: package)
@@ -71,18 +46,7 @@ extension SwiftPackageCommand {
                 dependency = .target(name: dependencyName, condition: nil)
             }
 
-            let editResult = try PackageModelSyntax.AddTargetDependency.addTargetDependency(
-                dependency,
-                targetName: targetName,
-                to: manifestSyntax
-            )
-
-            try editResult.applyEdits(
-                to: fileSystem,
-                manifest: manifestSyntax,
-                manifestPath: manifestPath,
-                verbose: !globalOptions.logging.quiet
-            )
+            return .addTargetDependency(dependency, targetName: targetName)
         }
     }
 }
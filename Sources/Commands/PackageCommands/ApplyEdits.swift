@@ -0,0 +1,125 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import ArgumentParser
+import Basics
+import CoreCommands
+import Foundation
+import PackageModel
+import PackageModelSyntax
+
+/// A command that makes a single edit to the manifest of the root package.
+protocol ManifestEditCommand: SwiftCommand {
+    /// The edit to make.
+    func manifestEdit(_ swiftCommandState: SwiftCommandState) throws -> ManifestEdit
+}
+
+extension ManifestEditCommand {
+    func run(_ swiftCommandState: SwiftCommandState) throws {
+        guard let packagePath = try swiftCommandState.getWorkspaceRoot().packages.first else {
+            throw StringError("unknown package")
+        }
+
+        var transaction = ManifestEditTransaction(fileSystem: swiftCommandState.fileSystem)
+        try transaction.apply(
+            self.manifestEdit(swiftCommandState),
+            toManifestAt: packagePath.appending(component: Manifest.filename)
+        )
+        try transaction.commit(verbose: !self.globalOptions.logging.quiet)
+    }
+}
+
+extension SwiftPackageCommand {
+    struct ApplyEdits: SwiftCommand {
+        package static let configuration = CommandConfiguration(
+            abstract: "Apply a batch of edits to one or more manifests",
+            discussion: """
+            The edits file contains a JSON array of edits, each of which has the arguments of one of the \
+            'add-dependency', 'add-product', 'add-target' or 'add-target-dependency' commands, and optionally the \
+            path of the package to edit, which defaults to the root package:
+
+                [
+                    { "arguments": ["add-target", "Lib"] },
+                    { "package": "Packages/Other", "arguments": ["add-product", "Lib", "--targets", "Lib"] }
+                ]
+
+            Each manifest is parsed once and nothing is written unless all edits succeed. Edits that add something a \
+            manifest already has are rejected.
+            """
+        )
+
+        struct Edit: Decodable {
+            /// The path of the package to edit, relative to the working directory.
+            var package: String?
+
+            /// The arguments of the edit command.
+            var arguments: [String]
+        }
+
+        @OptionGroup(visibility: .hidden)
+        var globalOptions: GlobalOptions
+
+        @Argument(help: "The absolute or relative path to the JSON file containing the edits")
+        var editsFile: AbsolutePath
+
+        @Flag(help: "Resolve the package dependencies once after all edits were applied")
+        var resolve: Bool = false
+
+        func run(_ swiftCommandState: SwiftCommandState) throws {
+            let fileSystem = swiftCommandState.fileSystem
+            let edits = try JSONDecoder.makeWithDefaults().decode(
+                path: self.editsFile,
+                fileSystem: fileSystem,
+                as: [Edit].self
+            )
+            let rootPackagePath = try swiftCommandState.getWorkspaceRoot().packages.first
+
+            var transaction = ManifestEditTransaction(fileSystem: fileSystem)
+            for (index, edit) in edits.enumerated() {
+                let command: any ManifestEditCommand
+                do {
+                    guard let parsedCommand = try SwiftPackageCommand.parseAsRoot(edit.arguments) as? any ManifestEditCommand
+                    else {
+                        throw StringError("'\(edit.arguments.first ?? "")' isn't a manifest edit command")
+                    }
+                    command = parsedCommand
+                } catch {
+                    throw StringError("invalid edit #\(index + 1): \(SwiftPackageCommand.message(for: error))")
+                }
+
+                let packagePath: AbsolutePath
+                if let package = edit.package {
+                    packagePath = try AbsolutePath(validating: package, relativeTo: swiftCommandState.originalWorkingDirectory)
+                } else if let rootPackagePath {
+                    packagePath = rootPackagePath
+                } else {
+                    throw StringError("unknown package")
+                }
+
+                do {
+                    try transaction.apply(
+                        command.manifestEdit(swiftCommandState),
+                        toManifestAt: packagePath.appending(component: Manifest.filename)
+                    )
+                } catch {
+                    throw StringError("edit #\(index + 1) failed: \(error.interpolationDescription)")
+                }
+            }
+
+            try transaction.commit(verbose: !self.globalOptions.logging.quiet)
+
+            if self.resolve {
+                try swiftCommandState.resolve()
+            }
+        }
+    }
+}
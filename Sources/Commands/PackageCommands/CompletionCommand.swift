@@ -64,28 +64,29 @@ extension SwiftPackageCommand {
                 let script = SwiftCommand.completionScript(for: .fish)
                 print(script)
             case .listDependencies:
-                let graph = try swiftCommandState.loadPackageGraph()
+                // Tab completion runs this on every key press, so answer from the snapshot of the package graph
+                // whenever it is up to date.
+                let graph = try swiftCommandState.loadPackageGraphSnapshot()
+                guard let rootPackage = graph.rootPackage else {
+                    return
+                }
                 // command's result output goes on stdout
                 // ie "swift package list-dependencies" should output to stdout
                 ShowDependencies.dumpDependenciesOf(
                     graph: graph,
-                    rootPackage: graph.rootPackages[graph.rootPackages.startIndex],
+                    rootPackage: rootPackage,
                     mode: .flatlist,
                     on: TSCBasic.stdoutStream
                 )
             case .listExecutables:
-                let graph = try swiftCommandState.loadPackageGraph()
-                let package = graph.rootPackages[graph.rootPackages.startIndex].underlying
-                let executables = package.modules.filter { $0.type == .executable }
-                for executable in executables {
-                    print(executable.name)
+                let graph = try swiftCommandState.loadPackageGraphSnapshot()
+                for executable in graph.rootPackage?.executables ?? [] {
+                    print(executable)
                 }
             case .listSnippets:
-                let graph = try swiftCommandState.loadPackageGraph()
-                let package = graph.rootPackages[graph.rootPackages.startIndex].underlying
-                let executables = package.modules.filter { $0.type == .snippet }
-                for executable in executables {
-                    print(executable.name)
+                let graph = try swiftCommandState.loadPackageGraphSnapshot()
+                for snippet in graph.rootPackage?.snippets ?? [] {
+                    print(snippet)
                 }
             }
         }
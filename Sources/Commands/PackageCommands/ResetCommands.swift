@@ -38,6 +38,37 @@ extension SwiftPackageCommand {
         }
     }
 
+    struct TrimCache: SwiftCommand {
+        static let configuration = CommandConfiguration(
+            abstract: "Evict the least recently used build directories and cache entries down to a size limit")
+
+        @OptionGroup(visibility: .hidden)
+        var globalOptions: GlobalOptions
+
+        @Option(help: "The maximum size of the build directories, e.g. 10G")
+        var maxScratchSize: ByteCount?
+
+        @Option(help: "The maximum size of the shared caches, e.g. 20G")
+        var maxCacheSize: ByteCount?
+
+        func validate() throws {
+            if self.maxScratchSize == nil && self.maxCacheSize == nil {
+                throw ValidationError("at least one of '--max-scratch-size' or '--max-cache-size' is required")
+            }
+        }
+
+        func run(_ swiftCommandState: SwiftCommandState) throws {
+            let result = try swiftCommandState.getActiveWorkspace().collectGarbage(
+                limits: .init(
+                    scratchDirectorySize: self.maxScratchSize?.bytes,
+                    sharedCacheSize: self.maxCacheSize?.bytes
+                ),
+                observabilityScope: swiftCommandState.observabilityScope
+            )
+            print("Removed \(result.removedPaths.count) entries, reclaiming \(result.reclaimedBytes) bytes")
+        }
+    }
+
     struct Reset: SwiftCommand {
         static let configuration = CommandConfiguration(
             abstract: "Reset the complete cache/build directory")
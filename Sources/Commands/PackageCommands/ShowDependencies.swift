@@ -36,13 +36,16 @@ extension SwiftPackageCommand {
         var outputPath: AbsolutePath?
 
         func run(_ swiftCommandState: SwiftCommandState) throws {
-            let graph = try swiftCommandState.loadPackageGraph()
+            let graph = try swiftCommandState.loadPackageGraphSnapshot()
+            guard let rootPackage = graph.rootPackage else {
+                throw StringError("no root package found")
+            }
             // command's result output goes on stdout
             // ie "swift package show-dependencies" should output to stdout
             let stream: OutputByteStream = try outputPath.map { try LocalFileOutputByteStream($0) } ?? TSCBasic.stdoutStream
             Self.dumpDependenciesOf(
                 graph: graph,
-                rootPackage: graph.rootPackages[graph.rootPackages.startIndex],
+                rootPackage: rootPackage,
                 mode: format,
                 on: stream
             )
@@ -53,6 +56,19 @@ extension SwiftPackageCommand {
             rootPackage: ResolvedPackage,
             mode: ShowDependenciesMode,
             on stream: OutputByteStream
+        ) {
+            let snapshot = PackageGraphSnapshot(graph: graph)
+            guard let rootPackage = snapshot.package(for: rootPackage.identity) else {
+                return
+            }
+            Self.dumpDependenciesOf(graph: snapshot, rootPackage: rootPackage, mode: mode, on: stream)
+        }
+
+        static func dumpDependenciesOf(
+            graph: PackageGraphSnapshot,
+            rootPackage: PackageGraphSnapshot.Package,
+            mode: ShowDependenciesMode,
+            on stream: OutputByteStream
         ) {
             let dumper: DependenciesDumper
             switch mode {
@@ -37,8 +37,10 @@ public struct SwiftPackageCommand: AsyncParsableCommand {
             AddProduct.self,
             AddTarget.self,
             AddTargetDependency.self,
+            ApplyEdits.self,
             Clean.self,
             PurgeCache.self,
+            TrimCache.self,
             Reset.self,
             Update.self,
             Describe.self,
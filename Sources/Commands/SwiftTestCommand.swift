@@ -1045,6 +1045,15 @@ final class ParallelTestRunner {
                         observabilityScope: self.observabilityScope,
                         library: .xctest
                     )
+                    // Run no more test processes at once than the enclosing build allows.
+                    let jobServerToken = Concurrency.jobServer?.acquireIfAvailable(
+                        observabilityScope: self.observabilityScope
+                    )
+                    defer {
+                        if let jobServerToken {
+                            Concurrency.jobServer?.release(jobServerToken)
+                        }
+                    }
                     var output = ""
                     let outputLock = NSLock()
                     let start = DispatchTime.now()
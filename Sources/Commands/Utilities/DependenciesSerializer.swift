@@ -17,12 +17,12 @@ import enum TSCBasic.JSON
 import protocol TSCBasic.OutputByteStream
 
 protocol DependenciesDumper {
-    func dump(graph: ModulesGraph, dependenciesOf: ResolvedPackage, on: OutputByteStream)
+    func dump(graph: PackageGraphSnapshot, dependenciesOf: PackageGraphSnapshot.Package, on: OutputByteStream)
 }
 
 final class PlainTextDumper: DependenciesDumper {
-    func dump(graph: ModulesGraph, dependenciesOf rootpkg: ResolvedPackage, on stream: OutputByteStream) {
-        func recursiveWalk(packages: [ResolvedPackage], prefix: String = "") {
+    func dump(graph: PackageGraphSnapshot, dependenciesOf rootpkg: PackageGraphSnapshot.Package, on stream: OutputByteStream) {
+        func recursiveWalk(packages: [PackageGraphSnapshot.Package], prefix: String = "") {
             var hanger = prefix + "├── "
 
             for (index, package) in packages.enumerated() {
@@ -30,9 +30,9 @@ final class PlainTextDumper: DependenciesDumper {
                     hanger = prefix + "└── "
                 }
 
-                let pkgVersion = package.manifest.version?.description ?? "unspecified"
+                let pkgVersion = package.version ?? "unspecified"
 
-                stream.send("\(hanger)\(package.identity.description)<\(package.manifest.packageLocation)@\(pkgVersion)>\n")
+                stream.send("\(hanger)\(package.identity.description)<\(package.location)@\(pkgVersion)>\n")
 
                 if !package.dependencies.isEmpty {
                     let replacement = (index == packages.count - 1) ?  "    " : "│   "
@@ -54,8 +54,8 @@ final class PlainTextDumper: DependenciesDumper {
 }
 
 final class FlatListDumper: DependenciesDumper {
-    func dump(graph: ModulesGraph, dependenciesOf rootpkg: ResolvedPackage, on stream: OutputByteStream) {
-        func recursiveWalk(packages: [ResolvedPackage]) {
+    func dump(graph: PackageGraphSnapshot, dependenciesOf rootpkg: PackageGraphSnapshot.Package, on stream: OutputByteStream) {
+        func recursiveWalk(packages: [PackageGraphSnapshot.Package]) {
             for package in packages {
                 stream.send(package.identity.description).send("\n")
                 if !package.dependencies.isEmpty {
@@ -70,12 +70,12 @@ final class FlatListDumper: DependenciesDumper {
 }
 
 final class DotDumper: DependenciesDumper {
-    func dump(graph: ModulesGraph, dependenciesOf rootpkg: ResolvedPackage, on stream: OutputByteStream) {
+    func dump(graph: PackageGraphSnapshot, dependenciesOf rootpkg: PackageGraphSnapshot.Package, on stream: OutputByteStream) {
         var nodesAlreadyPrinted: Set<String> = []
-        func printNode(_ package: ResolvedPackage) {
-            let url = package.manifest.packageLocation
+        func printNode(_ package: PackageGraphSnapshot.Package) {
+            let url = package.location
             if nodesAlreadyPrinted.contains(url) { return }
-            let pkgVersion = package.manifest.version?.description ?? "unspecified"
+            let pkgVersion = package.version ?? "unspecified"
             stream.send(#""\#(url)" [label="\#(package.identity.description)\n\#(url)\n\#(pkgVersion)"]"#).send("\n")
             nodesAlreadyPrinted.insert(url)
         }
@@ -85,11 +85,11 @@ final class DotDumper: DependenciesDumper {
             var dependency: String
         }
         var dependenciesAlreadyPrinted: Set<DependencyURLs> = []
-        func recursiveWalk(rootpkg: ResolvedPackage) {
+        func recursiveWalk(rootpkg: PackageGraphSnapshot.Package) {
             printNode(rootpkg)
             for dependency in graph.directDependencies(for: rootpkg) {
-                let rootURL = rootpkg.manifest.packageLocation
-                let dependencyURL = dependency.manifest.packageLocation
+                let rootURL = rootpkg.location
+                let dependencyURL = dependency.location
                 let urlPair = DependencyURLs(root: rootURL, dependency: dependencyURL)
                 if dependenciesAlreadyPrinted.contains(urlPair) { continue }
 
@@ -120,15 +120,15 @@ final class DotDumper: DependenciesDumper {
 }
 
 final class JSONDumper: DependenciesDumper {
-    func dump(graph: ModulesGraph, dependenciesOf rootpkg: ResolvedPackage, on stream: OutputByteStream) {
-        func convert(_ package: ResolvedPackage) -> JSON {
+    func dump(graph: PackageGraphSnapshot, dependenciesOf rootpkg: PackageGraphSnapshot.Package, on stream: OutputByteStream) {
+        func convert(_ package: PackageGraphSnapshot.Package) -> JSON {
             return .orderedDictionary([
                 "identity": .string(package.identity.description),
-                "name": .string(package.manifest.displayName), // TODO: remove?
-                "url": .string(package.manifest.packageLocation),
-                "version": .string(package.manifest.version?.description ?? "unspecified"),
+                "name": .string(package.displayName), // TODO: remove?
+                "url": .string(package.location),
+                "version": .string(package.version ?? "unspecified"),
                 "path": .string(package.path.pathString),
-                "dependencies": .array(package.dependencies.compactMap { graph.packages[$0] }.map(convert)),
+                "dependencies": .array(graph.directDependencies(for: package).map(convert)),
             ])
         }
 
@@ -0,0 +1,236 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import Basics
+import CoreCommands
+import Foundation
+import PackageGraph
+import PackageModel
+import Workspace
+
+import struct TSCBasic.ByteString
+import struct TSCBasic.SHA256
+
+/// The shape of a loaded package graph, which is all that read-only commands such as `show-dependencies` and the
+/// shell completion tool need.
+///
+/// The snapshot is stored in the scratch directory and records fingerprints of everything the graph was loaded from:
+/// the manifests and snippets of the root and local packages, `Package.resolved`, the mirrors configuration, the
+/// workspace state and the toolchain. As long as none of them changed, the snapshot can be used instead of loading
+/// the package graph.
+struct PackageGraphSnapshot: Codable, Equatable {
+    struct Package: Codable, Equatable {
+        var identity: PackageIdentity
+        var displayName: String
+        var location: String
+        var version: String?
+        var path: AbsolutePath
+        var dependencies: [PackageIdentity]
+        var executables: [String]
+        var snippets: [String]
+    }
+
+    /// The name of the snapshot file in the scratch directory.
+    static let filename = "package-graph-snapshot.json"
+
+    /// Bumped whenever the format of the snapshot changes.
+    static let currentSchemaVersion = 2
+
+    private(set) var schemaVersion = Self.currentSchemaVersion
+    private(set) var toolchain: String
+    private(set) var rootPaths: [AbsolutePath]
+
+    /// The fingerprints of the inputs of the graph, keyed by their paths.
+    private(set) var inputs: [String: String]
+
+    private(set) var rootPackages: [PackageIdentity]
+    private(set) var packages: [Package]
+
+    /// Creates a snapshot of the shape of `graph` without recording any of its inputs.
+    init(graph: ModulesGraph) {
+        self.toolchain = ""
+        self.rootPaths = []
+        self.inputs = [:]
+        self.rootPackages = graph.rootPackages.map(\.identity)
+        self.packages = graph.packages.map { package in
+            Package(
+                identity: package.identity,
+                displayName: package.manifest.displayName,
+                location: package.manifest.packageLocation,
+                version: package.manifest.version?.description,
+                path: package.path,
+                dependencies: package.dependencies,
+                executables: package.underlying.modules.filter { $0.type == .executable }.map(\.name),
+                snippets: package.underlying.modules.filter { $0.type == .snippet }.map(\.name)
+            )
+        }
+    }
+
+    /// Creates a snapshot of `graph`, which was loaded from `rootPaths` with `toolchain`, recording the fingerprints
+    /// of `inputPaths` and of the manifests of the root and local packages.
+    init(
+        graph: ModulesGraph,
+        rootPaths: [AbsolutePath],
+        inputPaths: [AbsolutePath],
+        toolchain: String,
+        fileSystem: FileSystem
+    ) {
+        self.init(graph: graph)
+        self.toolchain = toolchain
+        self.rootPaths = rootPaths
+
+        // Remote packages are pinned by `Package.resolved`, but local packages can change at any time.
+        let localPackagePaths = graph.packages.filter {
+            switch $0.manifest.packageKind {
+            case .root, .fileSystem, .localSourceControl:
+                return true
+            case .remoteSourceControl, .registry:
+                return false
+            }
+        }.map(\.path)
+
+        var inputs = [String: String]()
+        for path in inputPaths + rootPaths + localPackagePaths {
+            inputs[path.pathString] = Self.fingerprint(of: path, fileSystem: fileSystem)
+        }
+        self.inputs = inputs
+    }
+
+    var rootPackage: Package? {
+        self.rootPackages.first.flatMap { self.package(for: $0) }
+    }
+
+    func package(for identity: PackageIdentity) -> Package? {
+        self.packages.first { $0.identity == identity }
+    }
+
+    func directDependencies(for package: Package) -> [Package] {
+        package.dependencies.compactMap { self.package(for: $0) }
+    }
+
+    /// Whether the graph was loaded from the given roots with the given toolchain, and none of its inputs changed since.
+    func isUpToDate(rootPaths: [AbsolutePath], toolchain: String, fileSystem: FileSystem) -> Bool {
+        guard self.schemaVersion == Self.currentSchemaVersion,
+              self.rootPaths == rootPaths,
+              self.toolchain == toolchain
+        else {
+            return false
+        }
+        return self.inputs.allSatisfy { path, fingerprint in
+            guard let path = try? AbsolutePath(validating: path) else {
+                return false
+            }
+            return Self.fingerprint(of: path, fileSystem: fileSystem) == fingerprint
+        }
+    }
+
+    /// Returns the SHA-256 of the contents of the file at `path`, or of all the manifests and the names of the snippet
+    /// files in the package directory at `path`, so that adding a version-specific manifest or a snippet is noticed
+    /// too. Missing inputs have an empty fingerprint.
+    static func fingerprint(of path: AbsolutePath, fileSystem: FileSystem) -> String {
+        if fileSystem.isDirectory(path) {
+            let manifests = ((try? fileSystem.getDirectoryContents(path)) ?? [])
+                .filter { $0.hasPrefix(Manifest.basename) && $0.hasSuffix(".swift") }
+                .sorted()
+            var contents = [UInt8]()
+            for manifest in manifests {
+                guard let manifestContents = try? fileSystem.readFileContents(path.appending(component: manifest)) else {
+                    continue
+                }
+                contents += Array(manifest.utf8)
+                contents += SHA256().hash(manifestContents).contents
+            }
+            // Snippets aren't declared in the manifest, but discovered from the files in the `Snippets` directory.
+            for snippet in Self.snippetFiles(in: path.appending("Snippets"), fileSystem: fileSystem) {
+                contents += Array(snippet.pathString.utf8) + [0]
+            }
+            return SHA256().hash(ByteString(contents)).hexadecimalRepresentation
+        } else if let contents = try? fileSystem.readFileContents(path) {
+            return SHA256().hash(contents).hexadecimalRepresentation
+        } else {
+            return ""
+        }
+    }
+
+    /// Returns the paths of the Swift files in `directory` and its subdirectories relative to `directory`, sorted.
+    private static func snippetFiles(in directory: AbsolutePath, fileSystem: FileSystem) -> [RelativePath] {
+        guard fileSystem.isDirectory(directory) else {
+            return []
+        }
+        var files = [RelativePath]()
+        var directories = [directory]
+        while let current = directories.popLast() {
+            for name in (try? fileSystem.getDirectoryContents(current)) ?? [] {
+                let path = current.appending(component: name)
+                if fileSystem.isDirectory(path) {
+                    directories.append(path)
+                } else if name.hasSuffix(".swift") {
+                    files.append(path.relative(to: directory))
+                }
+            }
+        }
+        return files.sorted { $0.pathString < $1.pathString }
+    }
+}
+
+extension SwiftCommandState {
+    /// Returns the snapshot of the package graph, loading the package graph only if the stored snapshot is missing
+    /// or out of date.
+    func loadPackageGraphSnapshot() throws -> PackageGraphSnapshot {
+        let snapshotPath = self.scratchDirectory.appending(component: PackageGraphSnapshot.filename)
+        let rootPaths = try self.getWorkspaceRoot().packages
+        let toolchain = [
+            SwiftVersion.current.completeDisplayString,
+            self.options.build.customCompileToolchain?.pathString ?? "",
+            self.options.locations.swiftSDKsDirectory?.pathString ?? "",
+            self.options.build.swiftSDKSelector ?? "",
+        ].joined(separator: "\n")
+
+        if self.fileSystem.exists(snapshotPath),
+           let snapshot = try? JSONDecoder.makeWithDefaults().decode(
+               path: snapshotPath,
+               fileSystem: self.fileSystem,
+               as: PackageGraphSnapshot.self
+           ),
+           snapshot.isUpToDate(rootPaths: rootPaths, toolchain: toolchain, fileSystem: self.fileSystem)
+        {
+            self.observabilityScope.emit(debug: "using the package graph snapshot at '\(snapshotPath)'")
+            return snapshot
+        }
+
+        let graph = try self.loadPackageGraph()
+        let snapshot = try PackageGraphSnapshot(
+            graph: graph,
+            rootPaths: rootPaths,
+            inputPaths: [
+                self.getResolvedVersionsFile(),
+                self.getActiveWorkspace().state.storagePath,
+                self.getActiveWorkspace().location.localMirrorsConfigurationFile,
+                self.getActiveWorkspace().location.sharedMirrorsConfigurationFile,
+            ].compactMap { $0 },
+            toolchain: toolchain,
+            fileSystem: self.fileSystem
+        )
+        // The snapshot is only an optimization, so failing to store it isn't an error.
+        do {
+            try self.fileSystem.createDirectory(snapshotPath.parentDirectory, recursive: true)
+            try JSONEncoder.makeWithDefaults(prettified: false).encode(
+                path: snapshotPath,
+                fileSystem: self.fileSystem,
+                snapshot
+            )
+        } catch {
+            self.observabilityScope.emit(debug: "failed to store the package graph snapshot", underlyingError: error)
+        }
+        return snapshot
+    }
+}
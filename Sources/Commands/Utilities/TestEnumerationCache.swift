@@ -0,0 +1,84 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import Basics
+import Foundation
+
+/// The output of enumerating the tests of a test product, stored next to it.
+///
+/// Enumerating tests launches the test product, which can take seconds for products with heavy static
+/// initialization. The output is stored along with the inode, size and modification date of the test binary, so that
+/// the tests of a test product that wasn't relinked since are listed without launching it.
+struct TestEnumerationCache {
+    /// The identity of a test binary.
+    struct Key: Codable, Equatable {
+        var inode: UInt64
+        var size: UInt64
+        var modificationDate: Double
+    }
+
+    private struct Entry: Codable {
+        var key: Key
+        var output: String
+    }
+
+    /// The path of the cache file.
+    let path: AbsolutePath
+
+    /// The path of the binary the tests are enumerated from.
+    let binaryPath: AbsolutePath
+
+    private let fileSystem: any FileSystem
+
+    /// Creates the cache of the test product at `bundlePath`, which is an XCTest bundle on macOS and an executable
+    /// everywhere else.
+    init(testProductAt bundlePath: AbsolutePath, fileSystem: any FileSystem) {
+        self.path = bundlePath.parentDirectory.appending(component: "\(bundlePath.basename).tests.json")
+        #if os(macOS)
+        self.binaryPath = bundlePath.appending(components: "Contents", "MacOS", bundlePath.basenameWithoutExt)
+        #else
+        self.binaryPath = bundlePath
+        #endif
+        self.fileSystem = fileSystem
+    }
+
+    /// Returns the cached output if the binary didn't change since it was stored, or the output of `enumerate`,
+    /// which is then stored.
+    func output(orEnumerate enumerate: () throws -> String) throws -> String {
+        guard let key = try? self.key() else {
+            return try enumerate()
+        }
+
+        if let entry = try? JSONDecoder.makeWithDefaults().decode(
+            path: self.path,
+            fileSystem: self.fileSystem,
+            as: Entry.self
+        ), entry.key == key {
+            return entry.output
+        }
+
+        let output = try enumerate()
+        // The cache is only an optimization, so failing to store it isn't an error. Should the binary change while
+        // its tests are enumerated, the stored key doesn't match it and the entry is never used.
+        try? JSONEncoder.makeWithDefaults(prettified: false).encode(
+            path: self.path,
+            fileSystem: self.fileSystem,
+            Entry(key: key, output: output)
+        )
+        return output
+    }
+
+    private func key() throws -> Key {
+        let info = try self.fileSystem.getFileInfo(self.binaryPath)
+        return Key(inode: info.inode, size: info.size, modificationDate: info.modTime.timeIntervalSince1970)
+    }
+}
@@ -108,43 +108,51 @@ enum TestingSupport {
         experimentalTestOutput: Bool,
         sanitizers: [Sanitizer]
     ) throws -> [TestSuite] {
+        // Tests are only enumerated again if the test product was relinked.
+        let cache = TestEnumerationCache(testProductAt: path, fileSystem: swiftCommandState.fileSystem)
+
         // Run the correct tool.
         var args = [String]()
-        #if os(macOS)
-        let data: String = try withTemporaryFile { tempFile in
-            args = [try Self.xctestHelperPath(swiftCommandState: swiftCommandState).pathString, path.pathString, tempFile.path.pathString]
+        let data = try cache.output {
+            #if os(macOS)
+            return try withTemporaryFile { tempFile in
+                args = [try Self.xctestHelperPath(swiftCommandState: swiftCommandState).pathString, path.pathString, tempFile.path.pathString]
+                let env = try Self.constructTestEnvironment(
+                    toolchain: try swiftCommandState.getTargetToolchain(),
+                    destinationBuildParameters: swiftCommandState.buildParametersForTest(
+                        enableCodeCoverage: enableCodeCoverage,
+                        shouldSkipBuilding: shouldSkipBuilding,
+                        experimentalTestOutput: experimentalTestOutput,
+                        library: .xctest
+                    ).productsBuildParameters,
+                    sanitizers: sanitizers,
+                    library: .xctest
+                )
+
+                try AsyncProcess.checkNonZeroExit(arguments: args, environment: env)
+                // Read the temporary file's content.
+                return try swiftCommandState.fileSystem.readFileContents(AbsolutePath(tempFile.path))
+            }
+            #else
             let env = try Self.constructTestEnvironment(
                 toolchain: try swiftCommandState.getTargetToolchain(),
                 destinationBuildParameters: swiftCommandState.buildParametersForTest(
                     enableCodeCoverage: enableCodeCoverage,
                     shouldSkipBuilding: shouldSkipBuilding,
-                    experimentalTestOutput: experimentalTestOutput,
                     library: .xctest
                 ).productsBuildParameters,
                 sanitizers: sanitizers,
                 library: .xctest
             )
-
-            try AsyncProcess.checkNonZeroExit(arguments: args, environment: env)
-            // Read the temporary file's content.
-            return try swiftCommandState.fileSystem.readFileContents(AbsolutePath(tempFile.path))
+            args = [path.description, "--dump-tests-json"]
+            return try AsyncProcess.checkNonZeroExit(arguments: args, environment: env)
+            #endif
         }
-        #else
-        let env = try Self.constructTestEnvironment(
-            toolchain: try swiftCommandState.getTargetToolchain(),
-            destinationBuildParameters: swiftCommandState.buildParametersForTest(
-                enableCodeCoverage: enableCodeCoverage,
-                shouldSkipBuilding: shouldSkipBuilding,
-                library: .xctest
-            ).productsBuildParameters,
-            sanitizers: sanitizers,
-            library: .xctest
-        )
-        args = [path.description, "--dump-tests-json"]
-        let data = try AsyncProcess.checkNonZeroExit(arguments: args, environment: env)
-        #endif
         // Parse json and return TestSuites.
-        return try TestSuite.parse(jsonString: data, context: args.joined(separator: " "))
+        return try TestSuite.parse(
+            jsonString: data,
+            context: args.isEmpty ? cache.path.pathString : args.joined(separator: " ")
+        )
     }
 
     /// Creates the environment needed to test related tools.
@@ -174,6 +174,40 @@ public struct CachingOptions: ParsableArguments {
             self.init(rawValue: argument)
         }
     }
+
+    /// The size the build directories in the scratch directory are trimmed down to after a command completes.
+    @Option(name: .customLong("experimental-scratch-size-limit"), help: .hidden)
+    public var scratchDirectorySizeLimit: ByteCount?
+
+    /// The size the shared caches are trimmed down to after a command completes.
+    @Option(name: .customLong("experimental-cache-size-limit"), help: .hidden)
+    public var sharedCacheSizeLimit: ByteCount?
+}
+
+/// A number of bytes, optionally followed by a `K`, `M`, `G` or `T` binary unit suffix.
+public struct ByteCount: ExpressibleByArgument, Equatable {
+    public var bytes: UInt64
+
+    public init(bytes: UInt64) {
+        self.bytes = bytes
+    }
+
+    public init?(argument: String) {
+        var digits = Substring(argument.uppercased())
+        var multiplier: UInt64 = 1
+        if let unit = digits.last, let exponent = ["K", "M", "G", "T"].firstIndex(of: unit) {
+            digits = digits.dropLast()
+            multiplier = 1 << (10 * (exponent + 1))
+        }
+        guard let value = UInt64(digits) else {
+            return nil
+        }
+        let (bytes, overflow) = value.multipliedReportingOverflow(by: multiplier)
+        guard !overflow else {
+            return nil
+        }
+        self.bytes = bytes
+    }
 }
 
 public struct LoggingOptions: ParsableArguments {
@@ -464,6 +498,10 @@ public struct BuildOptions: ParsableArguments {
     @Flag(name: .customLong("experimental-explicit-module-build"))
     public var useExplicitModuleBuild: Bool = false
 
+    /// Whether Swift modules should only see the modules of their declared dependencies.
+    @Flag(name: .customLong("experimental-isolated-module-search-paths"), help: .hidden)
+    public var useIsolatedModuleSearchPaths: Bool = false
+
     /// The build system to use.
     @Option(name: .customLong("build-system"))
     var _buildSystem: BuildSystemProvider.Kind = .native
@@ -472,6 +510,20 @@ public struct BuildOptions: ParsableArguments {
     @Option(name: .customLong("debug-info-format", withSingleDash: true))
     public var debugInfoFormat: DebugInfoFormat = .dwarf
 
+    /// Whether to split DWARF of C-family sources into `.dwo` files, packaged per product if `llvm-dwp` is found.
+    @Flag(name: .customLong("experimental-split-dwarf"), help: .hidden)
+    public var shouldSplitDWARF: Bool = false
+
+    /// Whether to compress debug sections in objects and linked binaries.
+    @Flag(name: .customLong("experimental-compress-debug-sections"), help: .hidden)
+    public var shouldCompressDebugSections: Bool = false
+
+    /// Whether to remap the package and scratch directory paths in compiler outputs, so that objects don't depend on
+    /// where the package is checked out. The build manifest and database still use absolute paths, so moving the
+    /// package or the scratch directory still rebuilds everything.
+    @Flag(name: .customLong("experimental-remap-build-paths"), help: .hidden)
+    public var shouldRemapBuildPaths: Bool = false
+
     public var buildSystem: BuildSystemProvider.Kind {
         // Force the Xcode build system if we want to build more than one arch.
         return self.architectures.count > 1 ? .xcode : self._buildSystem
@@ -552,6 +604,43 @@ public struct LinkerOptions: ParsableArguments {
     /// Disables adding $ORIGIN/@loader_path to the rpath, useful when deploying
     @Flag(name: .customLong("disable-local-rpath"), help: "Disable adding $ORIGIN/@loader_path to the rpath by default")
     public var shouldDisableLocalRpath: Bool = false
+
+    /// The linker to use on platforms which allow selecting one.
+    @Option(name: .customLong("experimental-linker"), help: .hidden)
+    public var linkerFlavor: LinkerFlavor?
+
+    /// Whether to create thin archives for static library products in debug builds.
+    @Flag(name: .customLong("experimental-thin-archives"), help: .hidden)
+    public var shouldUseThinArchives: Bool = false
+
+    /// Whether to link automatic library products of dependencies as shared libraries in debug builds. The modules of
+    /// root packages are still linked statically into their executables, tests and snippets.
+    @Flag(name: .customLong("experimental-prefer-dynamic-libraries"), help: .hidden)
+    public var shouldPreferDynamicLibraries: Bool = false
+
+    /// Whether to only compile snippets when building everything, and link them when they're built or run on their own.
+    @Flag(name: .customLong("experimental-skip-snippet-linking"), help: .hidden)
+    public var shouldSkipSnippetLinking: Bool = false
+
+    /// The number of threads the linker may use.
+    @Option(name: .customLong("experimental-linker-threads"), help: .hidden)
+    public var linkerThreads: Int?
+
+    /// The number of products that may be linked at once.
+    @Option(name: .customLong("experimental-max-concurrent-link-jobs"), help: .hidden)
+    public var maxConcurrentLinkJobs: Int?
+
+    /// See `BuildParameters.Linker` for details.
+    public enum LinkerFlavor: String, Codable, ExpressibleByArgument {
+        /// Use `mold` or `lld`, whichever is installed, falling back to the toolchain's default linker.
+        case auto
+        /// See `BuildParameters.Linker.lld` for details.
+        case lld
+        /// See `BuildParameters.Linker.mold` for details.
+        case mold
+        /// See `BuildParameters.Linker.gold` for details.
+        case gold
+    }
 }
 
 /// Which testing libraries to use (and any related options.)
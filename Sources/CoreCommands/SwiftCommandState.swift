@@ -125,6 +125,9 @@ extension SwiftCommand {
             toolError = error
         }
 
+        if toolError == nil {
+            swiftCommandState.collectGarbageIfNeeded()
+        }
         swiftCommandState.releaseLockIfNeeded()
 
         // wait for all observability items to process
@@ -166,6 +169,9 @@ extension AsyncSwiftCommand {
             toolError = error
         }
 
+        if toolError == nil {
+            swiftCommandState.collectGarbageIfNeeded()
+        }
         swiftCommandState.releaseLockIfNeeded()
 
         // wait for all observability items to process
@@ -457,6 +463,9 @@ public final class SwiftCommandState {
                 prefetchBasedOnResolvedFile: options.resolver.shouldEnableResolverPrefetching,
                 shouldCreateMultipleTestProducts: toolWorkspaceConfiguration.wantsMultipleTestProducts || options.build.buildSystem == .xcode,
                 createREPLProduct: toolWorkspaceConfiguration.wantsREPLProduct,
+                preferDynamicLibraries: self.options.linker.shouldPreferDynamicLibraries
+                    && self.options.build.configuration == .debug
+                    && !self.options.linker.shouldDisableLocalRpath,
                 additionalFileRules: isXcodeBuildSystemEnabled ? FileRuleDescription.xcbuildFileTypes : FileRuleDescription.swiftpmFileTypes,
                 sharedDependenciesCacheEnabled: self.options.caching.useDependenciesCache,
                 fingerprintCheckingMode: self.options.security.fingerprintCheckingMode,
@@ -511,7 +520,7 @@ public final class SwiftCommandState {
         return try Workspace.DefaultLocations.editsDirectory(forRootPackage: self.getPackageRoot())
     }
 
-    private func getResolvedVersionsFile() throws -> AbsolutePath {
+    package func getResolvedVersionsFile() throws -> AbsolutePath {
         // TODO: replace multiroot-data-file with explicit overrides
         if let multiRootPackageDataFile = options.locations.multirootPackageDataFile {
             return multiRootPackageDataFile.appending(components: "xcshareddata", "swiftpm", Workspace.DefaultLocations.resolvedFileName)
@@ -758,6 +767,22 @@ public final class SwiftCommandState {
     when building on macOS.
     """
 
+    /// Maps the package root to `.` and a scratch directory outside of it to `.build`, the default location of the
+    /// scratch directory relative to the package root.
+    private var buildPathPrefixMappings: [BuildParameters.PathPrefixMapping] {
+        var mappings = [BuildParameters.PathPrefixMapping]()
+        if let packageRoot = self.packageRoot {
+            mappings.append(.init(path: packageRoot, replacement: "."))
+        }
+        let isScratchDirectoryInPackage = self.packageRoot.map {
+            self.scratchDirectory.isDescendantOfOrEqual(to: $0)
+        } ?? false
+        if !isScratchDirectoryInPackage {
+            mappings.append(.init(path: self.scratchDirectory, replacement: ".build"))
+        }
+        return mappings
+    }
+
     private func _buildParams(
         toolchain: UserToolchain,
         destination: BuildParameters.Destination,
@@ -773,6 +798,21 @@ public final class SwiftCommandState {
             observabilityScope.emit(warning: Self.entitlementsMacOSWarning)
         }
 
+        let linker = options.linker.linkerFlavor?.buildParameter(toolchain: toolchain)
+        if let linkerThreads = options.linker.linkerThreads {
+            guard linkerThreads > 0 else {
+                throw StringError("'--experimental-linker-threads' must be a positive number")
+            }
+            if linker == nil {
+                observabilityScope.emit(
+                    warning: "'--experimental-linker-threads' is ignored because no linker is selected with '--experimental-linker'"
+                )
+            }
+        }
+        if let maxConcurrentLinkJobs = options.linker.maxConcurrentLinkJobs, maxConcurrentLinkJobs < 1 {
+            throw StringError("'--experimental-max-concurrent-link-jobs' must be a positive number")
+        }
+
         return try BuildParameters(
             destination: destination,
             dataPath: dataPath,
@@ -792,7 +832,11 @@ public final class SwiftCommandState {
                 triple: triple,
                 shouldEnableDebuggingEntitlement:
                     options.build.getTaskAllowEntitlement ?? (options.build.configuration == .debug),
-                omitFramePointers: options.build.omitFramePointers
+                omitFramePointers: options.build.omitFramePointers,
+                shouldSplitDWARF: options.build.shouldSplitDWARF,
+                dwarfPackagerPath: options.build.shouldSplitDWARF ? toolchain.findDWARFPackager() : nil,
+                shouldCompressDebugSections: options.build.shouldCompressDebugSections,
+                pathPrefixMappings: options.build.shouldRemapBuildPaths ? self.buildPathPrefixMappings : []
             ),
             driverParameters: .init(
                 canRenameEntrypointFunctionName: DriverSupport.checkSupportedFrontendFlags(
@@ -804,6 +848,7 @@ public final class SwiftCommandState {
                 explicitTargetDependencyImportCheckingMode: options.build.explicitTargetDependencyImportCheck.modeParameter,
                 useIntegratedSwiftDriver: options.build.useIntegratedSwiftDriver,
                 useExplicitModuleBuild: options.build.useExplicitModuleBuild,
+                useIsolatedModuleSearchPaths: options.build.useIsolatedModuleSearchPaths,
                 isPackageAccessModifierSupported: DriverSupport.isPackageNameSupported(
                     toolchain: toolchain,
                     fileSystem: self.fileSystem
@@ -812,7 +857,12 @@ public final class SwiftCommandState {
             linkingParameters: .init(
                 linkerDeadStrip: options.linker.linkerDeadStrip,
                 linkTimeOptimizationMode: options.build.linkTimeOptimizationMode?.buildParameter,
-                shouldDisableLocalRpath: options.linker.shouldDisableLocalRpath
+                shouldDisableLocalRpath: options.linker.shouldDisableLocalRpath,
+                linker: linker,
+                linkerThreads: options.linker.linkerThreads,
+                shouldUseThinArchives: options.linker.shouldUseThinArchives,
+                shouldLinkSnippets: !options.linker.shouldSkipSnippetLinking,
+                maxConcurrentLinkJobs: options.linker.maxConcurrentLinkJobs
             ),
             outputParameters: .init(
                 isVerbose: self.logLevel <= .info
@@ -1001,6 +1051,31 @@ public final class SwiftCommandState {
         self.workspaceLock = workspaceLock
     }
 
+    /// Trims the scratch directory and the shared caches down to the configured size limits, if any, while the
+    /// workspace lock is still held.
+    fileprivate func collectGarbageIfNeeded() {
+        let limits = Workspace.GarbageCollectionLimits(
+            scratchDirectorySize: self.options.caching.scratchDirectorySizeLimit?.bytes,
+            sharedCacheSize: self.options.caching.sharedCacheSizeLimit?.bytes
+        )
+        // Only collect garbage for commands that used the workspace.
+        guard limits != .init(), let workspace = self._workspace else {
+            return
+        }
+
+        // The build directories of this invocation are in use.
+        let protectedPaths = [
+            try? self._productsBuildParameters.get().buildPath,
+            try? self._toolsBuildParameters.get().buildPath,
+        ].compactMap { $0 }
+
+        workspace.collectGarbage(
+            limits: limits,
+            protectedPaths: protectedPaths,
+            observabilityScope: self.observabilityScope
+        )
+    }
+
     fileprivate func releaseLockIfNeeded() {
         // Never having acquired the lock is not an error case.
         assert(workspaceLockState == .locked || workspaceLockState == .needsLocking, "attempting to `releaseLockIfNeeded()` from unexpected state: \(workspaceLockState)")
@@ -1159,6 +1234,22 @@ extension BuildOptions.LinkTimeOptimizationMode {
     }
 }
 
+extension LinkerOptions.LinkerFlavor {
+    fileprivate func buildParameter(toolchain: UserToolchain) -> BuildParameters.Linker? {
+        switch self {
+        case .auto:
+            // Prefer the fastest linker that is installed.
+            return [BuildParameters.Linker.mold, .lld].first { toolchain.findLinker(flavor: $0.rawValue) != nil }
+        case .lld:
+            return .lld
+        case .mold:
+            return .mold
+        case .gold:
+            return .gold
+        }
+    }
+}
+
 extension BuildOptions.DebugInfoFormat {
     fileprivate var buildParameter: BuildParameters.DebugInfoFormat {
         switch self {
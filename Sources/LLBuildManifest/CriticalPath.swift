@@ -0,0 +1,87 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+extension LLBuildManifest {
+    /// Returns how long it takes at least to finish each command once the build started, which is the command's own
+    /// duration plus the longest chain of commands it depends on, given how long each command takes.
+    ///
+    /// Commands without a known duration are assumed to take no time, and commands in dependency cycles, which
+    /// llbuild rejects anyway, are only assigned their own duration.
+    public func criticalPathLengths(commandDurations: [CmdName: Double]) -> [CmdName: Double] {
+        let producers = self.producers
+        var predecessors = [CmdName: Set<CmdName>]()
+        var successors = [CmdName: [CmdName]]()
+        for (name, command) in self.commands {
+            let commandPredecessors = Set(command.tool.inputs.compactMap { producers[$0] })
+            predecessors[name] = commandPredecessors
+            for predecessor in commandPredecessors {
+                successors[predecessor, default: []].append(name)
+            }
+        }
+
+        // Order the commands so that every command comes after the ones it depends on.
+        var pendingDependencies = predecessors.mapValues(\.count)
+        var order = self.commands.keys.filter { pendingDependencies[$0] == 0 }
+        var index = 0
+        while index < order.count {
+            for successor in successors[order[index], default: []] {
+                pendingDependencies[successor]! -= 1
+                if pendingDependencies[successor] == 0 {
+                    order.append(successor)
+                }
+            }
+            index += 1
+        }
+
+        var lengths = [CmdName: Double]()
+        for name in order {
+            let preceding = predecessors[name, default: []].lazy.compactMap { lengths[$0] }.max() ?? 0
+            lengths[name] = commandDurations[name, default: 0] + preceding
+        }
+        for name in self.commands.keys where lengths[name] == nil {
+            lengths[name] = commandDurations[name, default: 0]
+        }
+        return lengths
+    }
+
+    /// Orders the nodes of every target by the critical path length of the commands that produce them, longest
+    /// first.
+    ///
+    /// The nodes of targets are mostly produced by phony commands that group the outputs of a module or product, so
+    /// this ranks them by the longest chain of commands they depend on. llbuild starts commands in the order it
+    /// discovers them while computing the nodes of a target, so this starts the long poles of a build, like a large
+    /// module that a slow product depends on, before the commands that can wait.
+    public mutating func prioritizeCriticalPath(commandDurations: [CmdName: Double]) {
+        let lengths = self.criticalPathLengths(commandDurations: commandDurations)
+        let producers = self.producers
+
+        for targetName in self.targets.keys {
+            let nodes = self.targets[targetName]!.nodes
+            let priorities = nodes.map { producers[$0].flatMap { lengths[$0] } ?? 0 }
+            // Sort the indices to keep nodes of equal priority in their original order.
+            self.targets[targetName]!.nodes = nodes.indices
+                .sorted { (priorities[$0], -$0) > (priorities[$1], -$1) }
+                .map { nodes[$0] }
+        }
+    }
+
+    /// The commands that produce each node.
+    private var producers: [Node: CmdName] {
+        var producers = [Node: CmdName]()
+        for (name, command) in self.commands {
+            for output in command.tool.outputs {
+                producers[output] = name
+            }
+        }
+        return producers
+    }
+}
@@ -196,7 +196,7 @@ public struct LLBuildManifest {
     public typealias CmdName = String
 
     /// The targets in the manifest.
-    public private(set) var targets: [TargetName: Target] = [:]
+    public internal(set) var targets: [TargetName: Target] = [:]
 
     /// The commands in the manifest.
     public private(set) var commands: [CmdName: Command] = [:]
@@ -267,6 +267,17 @@ public struct LLBuildManifest {
         addCommand(name: name, tool: tool)
     }
 
+    public mutating func addLinkCmd(
+        name: String,
+        description: String,
+        inputs: [Node],
+        outputs: [Node],
+        arguments: [String]
+    ) {
+        let tool = LinkTool(description: description, inputs: inputs, outputs: outputs, arguments: arguments)
+        addCommand(name: name, tool: tool)
+    }
+
     public mutating func addEntitlementPlistCommand(entitlement: String, outputPath: AbsolutePath) {
         let inputs = WriteAuxiliary.EntitlementPlist.computeInputs(entitlement: entitlement)
         let tool = WriteAuxiliaryFile(inputs: inputs, outputFilePath: outputPath)
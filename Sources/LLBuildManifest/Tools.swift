@@ -89,6 +89,28 @@ public struct CopyTool: ToolProtocol {
     }
 }
 
+/// A link command that SwiftPM runs itself instead of llbuild, so that it can limit how many link commands run at
+/// once.
+public struct LinkTool: ToolProtocol {
+    public static let name: String = "link-tool"
+
+    public var description: String
+    public var inputs: [Node]
+    public var outputs: [Node]
+    public var arguments: [String]
+
+    init(description: String, inputs: [Node], outputs: [Node], arguments: [String]) {
+        self.description = description
+        self.inputs = inputs
+        self.outputs = outputs
+        self.arguments = arguments
+    }
+
+    public func write(to stream: inout ManifestToolStream) {
+        stream["description"] = self.description
+    }
+}
+
 /// Package structure tool is used to determine if the package has changed in some way
 /// that requires regenerating the build manifest file. This allows us to skip a lot of
 /// redundant work (package graph loading, build planning, manifest generation) during
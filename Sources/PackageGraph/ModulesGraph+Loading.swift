@@ -31,6 +31,7 @@ extension ModulesGraph {
         binaryArtifacts: [PackageIdentity: [String: BinaryArtifact]],
         shouldCreateMultipleTestProducts: Bool = false,
         createREPLProduct: Bool = false,
+        preferDynamicLibraries: Bool = false,
         customPlatformsRegistry: PlatformRegistry? = .none,
         customXCTestMinimumDeploymentTargets: [PackageModel.Platform: PlatformVersion]? = .none,
         testEntryPointPath: AbsolutePath? = nil,
@@ -47,6 +48,7 @@ extension ModulesGraph {
             binaryArtifacts: binaryArtifacts,
             shouldCreateMultipleTestProducts: shouldCreateMultipleTestProducts,
             createREPLProduct: createREPLProduct,
+            preferDynamicLibraries: preferDynamicLibraries,
             traitConfiguration: nil,
             customPlatformsRegistry: customPlatformsRegistry,
             customXCTestMinimumDeploymentTargets: customXCTestMinimumDeploymentTargets,
@@ -67,6 +69,7 @@ extension ModulesGraph {
         binaryArtifacts: [PackageIdentity: [String: BinaryArtifact]],
         shouldCreateMultipleTestProducts: Bool = false,
         createREPLProduct: Bool = false,
+        preferDynamicLibraries: Bool = false,
         traitConfiguration: TraitConfiguration? = nil,
         customPlatformsRegistry: PlatformRegistry? = .none,
         customXCTestMinimumDeploymentTargets: [PackageModel.Platform: PlatformVersion]? = .none,
@@ -242,6 +245,7 @@ extension ModulesGraph {
             unsafeAllowedPackages: unsafeAllowedPackages,
             platformRegistry: customPlatformsRegistry ?? .default,
             platformVersionProvider: platformVersionProvider,
+            preferDynamicLibraries: preferDynamicLibraries,
             fileSystem: fileSystem,
             observabilityScope: observabilityScope
         )
@@ -371,6 +375,7 @@ private func createResolvedPackages(
     unsafeAllowedPackages: Set<PackageReference>,
     platformRegistry: PlatformRegistry,
     platformVersionProvider: PlatformVersionProvider,
+    preferDynamicLibraries: Bool,
     fileSystem: FileSystem,
     observabilityScope: ObservabilityScope
 ) throws -> IdentifiableSet<ResolvedPackage> {
@@ -782,7 +787,7 @@ private func createResolvedPackages(
                 KeyedPair($0, key: $0.module)
             }
         }
-        if let cycle = findCycle(moduleBuilders, successors: {
+        if let cycle = CompactGraph(roots: moduleBuilders, successors: {
             $0.item.dependencies.flatMap {
                 switch $0 {
                 case .product(let productBuilder, conditions: _):
@@ -791,7 +796,7 @@ private func createResolvedPackages(
                     return [] // local modules were checked by PackageBuilder.
                 }
             }
-        }) {
+        }).findCycle() {
             observabilityScope.emit(
                 ModuleError.cycleDetected(
                     (cycle.path.map(\.key.name), cycle.cycle.map(\.key.name))
@@ -801,9 +806,113 @@ private func createResolvedPackages(
         }
     }
 
+    if preferDynamicLibraries {
+        try linkAutomaticLibrariesDynamically(packageBuilders: packageBuilders, observabilityScope: observabilityScope)
+    }
+
     return IdentifiableSet(try packageBuilders.map { try $0.construct() })
 }
 
+/// Turns the automatic library products that can safely be linked as shared
+/// libraries into dynamic library products, so that the executables and tests
+/// depending on them link against one shared library instead of statically
+/// linking all of its modules again.
+///
+/// A shared library contains the modules of its product and their module
+/// dependencies in the same package. If one of those modules was also linked
+/// into another library, an executable depending on both would contain it
+/// twice. A product is therefore kept automatic if its modules overlap with
+/// the ones of another library product of its package, or if it depends on an
+/// automatic or static library product of another package that is kept as is.
+///
+/// The library products of root packages are kept automatic too: the
+/// executables, tests and snippets of a root package depend on its modules
+/// directly and link them statically, so a shared library for one of its
+/// products would only be linked in addition.
+private func linkAutomaticLibrariesDynamically(
+    packageBuilders: [ResolvedPackageBuilder],
+    observabilityScope: ObservabilityScope
+) throws {
+    /// The modules of `product` and their module dependencies in the same package.
+    func localModules(of product: ResolvedProductBuilder) -> [ResolvedModuleBuilder] {
+        var visited = Set<ObjectIdentifier>()
+        var result = [ResolvedModuleBuilder]()
+        var stack = product.moduleBuilders
+        while let module = stack.popLast() {
+            guard visited.insert(ObjectIdentifier(module)).inserted else {
+                continue
+            }
+            result.append(module)
+            for case .module(let dependency, _) in module.dependencies {
+                stack.append(dependency)
+            }
+        }
+        return result
+    }
+
+    var candidates = [ObjectIdentifier: (product: ResolvedProductBuilder, modules: [ResolvedModuleBuilder])]()
+    for packageBuilder in packageBuilders where !packageBuilder.package.manifest.packageKind.isRoot {
+        let libraries = packageBuilder.products.filter {
+            if case .library = $0.product.type {
+                return true
+            }
+            return false
+        }
+        let librariesByModule = libraries.reduce(into: [ObjectIdentifier: Int]()) { result, product in
+            for module in localModules(of: product) {
+                result[ObjectIdentifier(module), default: 0] += 1
+            }
+        }
+        for product in libraries where product.product.type == .library(.automatic) {
+            guard product.moduleBuilders.allSatisfy({ $0.module.type == .library }) else {
+                continue
+            }
+            let modules = localModules(of: product)
+            guard modules.allSatisfy({ librariesByModule[ObjectIdentifier($0)] == 1 }) else {
+                continue
+            }
+            candidates[ObjectIdentifier(product)] = (product, modules)
+        }
+    }
+
+    // Dropping a candidate can invalidate the candidates depending on it, so
+    // repeat until nothing changes.
+    var changed = true
+    while changed {
+        changed = false
+        for (id, candidate) in candidates {
+            let linksStatically = candidate.modules.contains { module in
+                module.dependencies.contains {
+                    guard case .product(let dependency, _) = $0 else {
+                        return false
+                    }
+                    switch dependency.product.type {
+                    case .library(.automatic), .library(.static):
+                        return candidates[ObjectIdentifier(dependency)] == nil
+                    case .library(.dynamic), .executable, .snippet, .plugin, .test, .macro:
+                        return false
+                    }
+                }
+            }
+            if linksStatically {
+                candidates[id] = nil
+                changed = true
+            }
+        }
+    }
+
+    for (product, _) in candidates.values {
+        observabilityScope.emit(debug: "linking library product '\(product.product.name)' dynamically")
+        product.product = try Product(
+            package: product.packageBuilder.package.identity,
+            name: product.product.name,
+            type: .library(.dynamic),
+            modules: product.product.modules,
+            testEntryPointPath: product.product.testEntryPointPath
+        )
+    }
+}
+
 private func emitDuplicateProductDiagnostic(
     productName: String,
     packages: [Package],
@@ -1068,7 +1177,7 @@ private final class ResolvedProductBuilder: ResolvedBuilder<ResolvedProduct> {
     unowned let packageBuilder: ResolvedPackageBuilder
 
     /// The product reference.
-    let product: Product
+    var product: Product
 
     /// The module builders in the product.
     let moduleBuilders: [ResolvedModuleBuilder]
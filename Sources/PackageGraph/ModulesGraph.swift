@@ -12,6 +12,7 @@
 
 import protocol Basics.FileSystem
 import class Basics.ObservabilityScope
+import struct Basics.CompactGraph
 import struct Basics.IdentifiableSet
 import OrderedCollections
 import PackageLoading
@@ -111,7 +112,9 @@ public struct ModulesGraph {
     /// dependencies).
     package var allModulesInTopologicalOrder: [ResolvedModule] {
         get throws {
-            try topologicalSort(Array(allModules)) { $0.dependencies.compactMap { $0.module } }.reversed()
+            try CompactGraph(roots: Array(allModules)) { $0.dependencies.compactMap { $0.module } }
+                .topologicalSort()
+                .reversed()
         }
     }
 
@@ -359,9 +362,9 @@ public struct ModulesGraph {
 
         for module in rootModules where module.type == .executable {
             // Find all dependencies of this module within its package. Note that we do not traverse plugin usages.
-            let dependencies = try topologicalSort(module.dependencies, successors: {
+            let dependencies = try CompactGraph(roots: module.dependencies, successors: {
                 $0.dependencies.compactMap{ $0.module }.filter{ $0.type != .plugin }.map{ .module($0, conditions: []) }
-            }).compactMap({ $0.module })
+            }).topologicalSort().compactMap({ $0.module })
 
             // Include the test modules whose dependencies intersect with the
             // current module's (recursive) dependencies.
@@ -521,6 +524,7 @@ public func loadModulesGraph(
     explicitProduct: String? = .none,
     shouldCreateMultipleTestProducts: Bool = false,
     createREPLProduct: Bool = false,
+    preferDynamicLibraries: Bool = false,
     useXCBuildFileRules: Bool = false,
     customXCTestMinimumDeploymentTargets: [PackageModel.Platform: PlatformVersion]? = .none,
     observabilityScope: ObservabilityScope
@@ -552,6 +556,7 @@ public func loadModulesGraph(
         binaryArtifacts: binaryArtifacts,
         shouldCreateMultipleTestProducts: shouldCreateMultipleTestProducts,
         createREPLProduct: createREPLProduct,
+        preferDynamicLibraries: preferDynamicLibraries,
         customXCTestMinimumDeploymentTargets: customXCTestMinimumDeploymentTargets,
         fileSystem: fileSystem,
         observabilityScope: observabilityScope
@@ -140,15 +140,20 @@ extension Incompatibility {
 /// same incompatibility, but have these combined by intersecting their version
 /// requirements to a^1.5.0.
 private func normalize(terms: [Term]) throws -> [Term] {
-    let dict = try terms.reduce(into: OrderedCollections.OrderedDictionary<DependencyResolutionNode, (req: VersionSetSpecifier, polarity: Bool)>()) {
-        res, term in
+    // Incompatibilities only have a handful of terms, so a linear search for
+    // an earlier term of the same package is cheaper than hashing them.
+    var result = [Term]()
+    result.reserveCapacity(terms.count)
+    for term in terms {
         // Don't try to intersect if this is the first time we're seeing this package.
-        guard let previous = res[term.node] else {
-            res[term.node] = (term.requirement, term.isPositive)
-            return
+        guard let index = result.firstIndex(where: { $0.node == term.node }) else {
+            result.append(term)
+            continue
         }
 
-        guard let intersection = term.intersect(withRequirement: previous.req, andPolarity: previous.polarity) else {
+        let previous = result[index]
+        guard let intersection = term.intersect(withRequirement: previous.requirement, andPolarity: previous.isPositive)
+        else {
             throw InternalError("""
             Attempting to create an incompatibility with terms for \(term.node) \
             intersecting versions \(previous) and \(term.requirement). These are \
@@ -156,7 +161,7 @@ private func normalize(terms: [Term]) throws -> [Term] {
             irrelevant.
             """)
         }
-        res[term.node] = (intersection.requirement, intersection.isPositive)
+        result[index] = intersection
     }
-    return dict.map { Term(node: $0, requirement: $1.req, isPositive: $1.polarity) }
+    return result
 }
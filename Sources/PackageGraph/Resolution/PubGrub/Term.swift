@@ -180,10 +180,10 @@ extension Term: CustomStringConvertible {
 
 extension VersionSetSpecifier {
     fileprivate func containsAll(_ other: VersionSetSpecifier) -> Bool {
-        self.intersection(other) == other
+        self.isSuperset(of: other)
     }
 
     fileprivate func containsAny(_ other: VersionSetSpecifier) -> Bool {
-        self.intersection(other) != .empty
+        !self.isDisjoint(with: other)
     }
 }
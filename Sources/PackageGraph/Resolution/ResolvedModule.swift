@@ -12,6 +12,7 @@
 
 import PackageModel
 
+import struct Basics.CompactGraph
 import struct Basics.IdentifiableSet
 
 @available(*, deprecated, renamed: "ResolvedModule")
@@ -87,12 +88,12 @@ public struct ResolvedModule {
 
     /// Returns the recursive dependencies, across the whole package-graph.
     public func recursiveDependencies() throws -> [Dependency] {
-        try topologicalSort(self.dependencies) { $0.dependencies }
+        try CompactGraph(roots: self.dependencies) { $0.dependencies }.topologicalSort()
     }
 
     /// Returns the recursive module dependencies, across the whole package-graph.
     public func recursiveModuleDependencies() throws -> [ResolvedModule] {
-        try topologicalSort(self.dependencies) { $0.dependencies }.compactMap { $0.module }
+        try CompactGraph(roots: self.dependencies) { $0.dependencies }.topologicalSort().compactMap { $0.module }
     }
 
     /// Returns the recursive dependencies, across the whole modules graph, which satisfy the input build environment,
@@ -100,9 +101,9 @@ public struct ResolvedModule {
     /// - Parameters:
     ///     - environment: The build environment to use to filter dependencies on.
     public func recursiveDependencies(satisfying environment: BuildEnvironment) throws -> [Dependency] {
-        try topologicalSort(dependencies(satisfying: environment)) { dependency in
+        try CompactGraph(roots: dependencies(satisfying: environment)) { dependency in
             dependency.dependencies.filter { $0.satisfies(environment) }
-        }
+        }.topologicalSort()
     }
 
     /// Collect all of the plugins that the current target depends on.
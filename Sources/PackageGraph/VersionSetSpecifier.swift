@@ -466,6 +466,91 @@ extension VersionSetSpecifier {
     }
 }
 
+extension VersionSetSpecifier {
+    /// Check if the set contains all versions of another set, i.e. if
+    /// `self.intersection(other) == other`, without computing the
+    /// intersection when neither set is a list of ranges.
+    public func isSuperset(of other: VersionSetSpecifier) -> Bool {
+        switch (self, other) {
+        case (.any, _):
+            return true
+        case (_, .any):
+            return false
+        case (.empty, _):
+            return other.isEmpty
+        case (_, .empty):
+            return true
+        case (.range(let lhs), .range(let rhs)):
+            if let intersection = VersionSetSpecifier.intersection(lhs, rhs) {
+                return intersection == rhs
+            }
+            return rhs.lowerBound == rhs.upperBound
+        case (.exact(let v), _):
+            return other.contains(v) ? self == other : other.isEmpty
+        case (_, .exact(let v)):
+            return self.contains(v)
+        case (.ranges, _), (_, .ranges):
+            // The intersection of lists of ranges is normalized by merging
+            // adjacent ranges, which has to be reproduced to compare it.
+            return self.intersection(other) == other
+        }
+    }
+
+    /// Check if the set has no versions in common with another set, i.e. if
+    /// `self.intersection(other) == .empty`, without computing the
+    /// intersection.
+    public func isDisjoint(with other: VersionSetSpecifier) -> Bool {
+        switch (self, other) {
+        case (.any, _):
+            return other.isEmpty
+        case (_, .any):
+            return self.isEmpty
+        case (.empty, _), (_, .empty):
+            return true
+        case (.range(let lhs), .range(let rhs)):
+            return VersionSetSpecifier.intersection(lhs, rhs) == nil
+        case (.exact(let v), _):
+            return !other.contains(v)
+        case (_, .exact(let v)):
+            return !self.contains(v)
+        case (.ranges(let ranges), .range(let range)), (.range(let range), .ranges(let ranges)):
+            return !VersionSetSpecifier.intersects(ranges, CollectionOfOne(range))
+        case (.ranges(let lhs), .ranges(let rhs)):
+            return !VersionSetSpecifier.intersects(lhs, rhs)
+        }
+    }
+
+    /// Whether the set is equal to `.empty`.
+    private var isEmpty: Bool {
+        self == .empty
+    }
+
+    /// Walks the sorted lists like `intersection(_:_:)` and stops at the
+    /// first overlap.
+    fileprivate static func intersects<Lhs: Sequence, Rhs: Sequence>(_ lhs: Lhs, _ rhs: Rhs) -> Bool
+        where Lhs.Element == Range<Version>, Rhs.Element == Range<Version>
+    {
+        var lhsItr = lhs.makeIterator()
+        var rhsItr = rhs.makeIterator()
+
+        var currentLhs = lhsItr.next()
+        var currentRhs = rhsItr.next()
+
+        while let lhs = currentLhs, let rhs = currentRhs {
+            if VersionSetSpecifier.intersection(lhs, rhs) != nil {
+                return true
+            }
+
+            if lhs.upperBound < rhs.upperBound {
+                currentLhs = lhsItr.next()
+            } else {
+                currentRhs = rhsItr.next()
+            }
+        }
+        return false
+    }
+}
+
 extension VersionSetSpecifier: CustomStringConvertible {
     public var description: String {
         switch self {
@@ -924,8 +924,12 @@ public final class ManifestLoader: ManifestLoaderProtocol {
 
         cmd += self.extraManifestFlags
 
-        // wrap the completion to free concurrency control semaphore
+        // wrap the completion to free concurrency control semaphore and jobserver token
+        let jobServerToken = ThreadSafeBox<JobServer.Token>()
         let completion: (Result<EvaluationResult, Error>) -> Void = { result in
+            if let token = jobServerToken.get() {
+                Concurrency.jobServer?.release(token)
+            }
             self.concurrencySemaphore.signal()
             completion(result)
         }
@@ -935,6 +939,10 @@ public final class ManifestLoader: ManifestLoaderProtocol {
             do {
                 // park the evaluation thread based on the max concurrency allowed
                 self.concurrencySemaphore.wait()
+                // and on the jobs the enclosing build allows
+                if let token = Concurrency.jobServer?.acquireIfAvailable(observabilityScope: observabilityScope) {
+                    jobServerToken.put(token)
+                }
                 // run the evaluation
                 let compileStart = DispatchTime.now()
                 delegateQueue?.async {
@@ -1160,7 +1168,7 @@ public final class ManifestLoader: ManifestLoaderProtocol {
     }
 
     /// Returns path to the manifest database inside the given cache directory.
-    private static func manifestCacheDBPath(_ cacheDir: AbsolutePath) -> AbsolutePath {
+    package static func manifestCacheDBPath(_ cacheDir: AbsolutePath) -> AbsolutePath {
         return cacheDir.appending("manifest.db")
     }
 
@@ -39,6 +39,7 @@ public struct PkgConfig {
     ///
     /// - parameter name: Name of the pkg config file (without file extension).
     /// - parameter additionalSearchPaths: Additional paths to search for pkg config file.
+    /// - parameter loadingContext: Records the pkg config files that were loaded and the paths searched for them.
     /// - parameter fileSystem: The file system to use
     ///
     /// - throws: PkgConfigError
@@ -47,6 +48,7 @@ public struct PkgConfig {
         additionalSearchPaths: [AbsolutePath]? = .none,
         brewPrefix: AbsolutePath? = .none,
         sysrootDir: AbsolutePath? = .none,
+        loadingContext: LoadingContext = LoadingContext(),
         fileSystem: FileSystem,
         observabilityScope: ObservabilityScope
     ) throws {
@@ -55,7 +57,8 @@ public struct PkgConfig {
             additionalSearchPaths: additionalSearchPaths ?? [],
             brewPrefix: brewPrefix,
             sysrootDir: sysrootDir,
-            loadingContext: LoadingContext(),
+            isTopLevel: true,
+            loadingContext: loadingContext,
             fileSystem: fileSystem,
             observabilityScope: observabilityScope
         )
@@ -66,10 +69,14 @@ public struct PkgConfig {
         additionalSearchPaths: [AbsolutePath],
         brewPrefix: AbsolutePath?,
         sysrootDir: AbsolutePath?,
+        isTopLevel: Bool = false,
         loadingContext: LoadingContext,
         fileSystem: FileSystem,
         observabilityScope: ObservabilityScope
     ) throws {
+        if isTopLevel {
+            loadingContext.pkgConfigStack = []
+        }
         loadingContext.pkgConfigStack.append(name)
 
         if let path = try? AbsolutePath(validating: name) {
@@ -79,13 +86,16 @@ public struct PkgConfig {
         } else {
             self.name = name
             let pkgFileFinder = PCFileFinder(brewPrefix: brewPrefix)
+            let customSearchPaths = try PkgConfig.envSearchPaths + additionalSearchPaths
+            loadingContext.searchPaths.append(contentsOf: pkgFileFinder.searchPaths(customSearchPaths: customSearchPaths))
             self.pcFile = try pkgFileFinder.locatePCFile(
                 name: name,
-                customSearchPaths: try PkgConfig.envSearchPaths + additionalSearchPaths,
+                customSearchPaths: customSearchPaths,
                 fileSystem: fileSystem,
                 observabilityScope: observabilityScope
             )
         }
+        loadingContext.pcFiles.append(self.pcFile)
 
         var parser = try PkgConfigParser(pcFile: pcFile, fileSystem: fileSystem, sysrootDir: Environment.current["PKG_CONFIG_SYSROOT_DIR"])
         try parser.parse()
@@ -149,6 +159,12 @@ extension PkgConfig {
         }
 
         public var pkgConfigStack: [String]
+
+        /// The pkg config files that were loaded, including the ones of dependencies.
+        public internal(set) var pcFiles = OrderedSet<AbsolutePath>()
+
+        /// The directories that were searched for pkg config files.
+        public internal(set) var searchPaths = OrderedSet<AbsolutePath>()
     }
 }
 
@@ -514,6 +530,11 @@ internal struct PCFileFinder {
         PCFileFinder.pkgConfigPaths = nil
     }
 
+    /// The directories searched for `.pc` files, in order.
+    func searchPaths(customSearchPaths: [AbsolutePath]) -> OrderedSet<AbsolutePath> {
+        OrderedSet(customSearchPaths + PCFileFinder.pkgConfigPaths! + PCFileFinder.searchPaths)
+    }
+
     public func locatePCFile(
         name: String,
         customSearchPaths: [AbsolutePath],
@@ -523,7 +544,7 @@ internal struct PCFileFinder {
         // FIXME: We should consider building a registry for all items in the
         // search paths, which is likely to be substantially more efficient if
         // we end up searching for a reasonably sized number of packages.
-        for path in OrderedSet(customSearchPaths + PCFileFinder.pkgConfigPaths! + PCFileFinder.searchPaths) {
+        for path in self.searchPaths(customSearchPaths: customSearchPaths) {
             let pcFile = path.appending(component: name + ".pc")
             if fileSystem.isFile(pcFile) {
                 return pcFile
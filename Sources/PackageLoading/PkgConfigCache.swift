@@ -0,0 +1,188 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import Basics
+import Foundation
+import PackageModel
+
+/// Persistent cache of the pkg-config flags of system library modules.
+///
+/// Resolving the flags of a system library module locates and parses its `.pc` files and the ones they require, and
+/// may spawn `pkg-config` or `brew` to find the directories to search. The cache stores the resolved flags along with
+/// the modification dates of the `.pc` files and of the searched directories, so that later builds reuse them without
+/// doing any of that work as long as neither those, the search paths nor the relevant environment variables changed.
+public struct PkgConfigCache {
+    /// The environment variables that affect where `.pc` files are found and how they are parsed. `PATH` determines
+    /// which `pkg-config` and `brew` are asked for search paths.
+    static let environmentVariables: [EnvironmentKey] = [
+        .path,
+        "PKG_CONFIG_PATH",
+        "PKG_CONFIG_LIBDIR",
+        "PKG_CONFIG_SYSROOT_DIR",
+    ]
+
+    /// Bumped whenever the format of the cache changes.
+    static let currentSchemaVersion = 1
+
+    struct Entry: Codable, Equatable {
+        /// The inputs of the resolution other than files.
+        struct Key: Codable, Equatable {
+            var pkgConfig: String
+            var providers: [SystemPackageProviderDescription]?
+            var pkgConfigDirectories: [AbsolutePath]
+            var sdkRootPath: AbsolutePath?
+            var environment: [String: String]
+        }
+
+        /// A file or directory the resolution depends on, with its modification date or `nil` if it doesn't exist.
+        struct Dependency: Codable, Equatable {
+            var path: AbsolutePath
+            var modificationDate: Double?
+        }
+
+        struct Result: Codable, Equatable {
+            var pkgConfigName: String
+            var cFlags: [String]
+            var libs: [String]
+        }
+
+        var key: Key
+        var dependencies: [Dependency]
+        var results: [Result]
+    }
+
+    private struct Storage: Codable {
+        var schemaVersion: Int
+        var entries: [String: Entry]
+    }
+
+    /// The path of the cache file.
+    public let path: AbsolutePath
+
+    private let fileSystem: FileSystem
+
+    /// The entries keyed by the paths of their system library modules.
+    private(set) var entries: [String: Entry]
+
+    /// Loads the cache stored at `path`. A missing or unreadable cache is treated as empty.
+    public init(path: AbsolutePath, fileSystem: FileSystem) {
+        self.path = path
+        self.fileSystem = fileSystem
+
+        if fileSystem.exists(path),
+           let storage = try? JSONDecoder.makeWithDefaults().decode(path: path, fileSystem: fileSystem, as: Storage.self),
+           storage.schemaVersion == Self.currentSchemaVersion
+        {
+            self.entries = storage.entries
+        } else {
+            self.entries = [:]
+        }
+    }
+
+    /// Returns the pkgConfig results for a system library target, from the cache if its entry is still valid.
+    ///
+    /// Results are only cached if all of them succeeded without warnings, so that the diagnostics of failing ones and
+    /// warnings, like the ones about circular dependencies, are emitted on every build. Newly cached results are stored
+    /// right away.
+    public mutating func pkgConfigArgs(
+        for target: SystemLibraryModule,
+        pkgConfigDirectories: [AbsolutePath],
+        sdkRootPath: AbsolutePath? = nil,
+        observabilityScope: ObservabilityScope
+    ) throws -> [PkgConfigResult] {
+        guard let pkgConfig = target.pkgConfig else { return [] }
+
+        let key = Entry.Key(
+            pkgConfig: pkgConfig,
+            providers: target.providers,
+            pkgConfigDirectories: pkgConfigDirectories,
+            sdkRootPath: sdkRootPath,
+            environment: Self.environmentVariables.reduce(into: [:]) { environment, variable in
+                environment[variable.rawValue] = Environment.current[variable]
+            }
+        )
+
+        let entryKey = target.path.pathString
+        if let entry = self.entries[entryKey], entry.key == key, self.isValid(entry) {
+            observabilityScope.emit(debug: "using cached pkg-config flags of '\(target.name)'")
+            return entry.results.map {
+                PkgConfigResult(pkgConfigName: $0.pkgConfigName, cFlags: $0.cFlags, libs: $0.libs)
+            }
+        }
+
+        // The diagnostics of the resolution are forwarded to `observabilityScope`, noting whether there were warnings.
+        let hadWarnings = ThreadSafeBox<Bool>(false)
+        let forwardingScope = ObservabilitySystem { _, diagnostic in
+            if diagnostic.severity >= .warning {
+                hadWarnings.put(true)
+            }
+            observabilityScope.emit(diagnostic)
+        }.topScope
+
+        let loadingContext = PkgConfig.LoadingContext()
+        let results = try PackageLoading.pkgConfigArgs(
+            for: target,
+            pkgConfigDirectories: pkgConfigDirectories,
+            sdkRootPath: sdkRootPath,
+            brewPrefix: nil,
+            loadingContext: loadingContext,
+            fileSystem: self.fileSystem,
+            observabilityScope: forwardingScope
+        )
+
+        guard results.allSatisfy({ $0.error == nil }), hadWarnings.get() != true else {
+            self.entries[entryKey] = nil
+            return results
+        }
+
+        let paths = Array(loadingContext.pcFiles) + Array(loadingContext.searchPaths)
+        guard let dependencies = try? paths.map({ Entry.Dependency(path: $0, modificationDate: try self.modificationDate(of: $0)) })
+        else {
+            // Without modification dates there is no way to tell when the entry becomes stale.
+            return results
+        }
+        self.entries[entryKey] = Entry(
+            key: key,
+            dependencies: dependencies,
+            results: results.map { Entry.Result(pkgConfigName: $0.pkgConfigName, cFlags: $0.cFlags, libs: $0.libs) }
+        )
+
+        // The cache is only an optimization, so failing to store it isn't an error.
+        do {
+            try self.fileSystem.createDirectory(self.path.parentDirectory, recursive: true)
+            try JSONEncoder.makeWithDefaults(prettified: false).encode(
+                path: self.path,
+                fileSystem: self.fileSystem,
+                Storage(schemaVersion: Self.currentSchemaVersion, entries: self.entries)
+            )
+        } catch {
+            observabilityScope.emit(debug: "failed to store the pkg-config cache", underlyingError: error)
+        }
+
+        return results
+    }
+
+    /// Whether none of the files and directories the entry depends on changed. Adding a `.pc` file to a searched
+    /// directory changes the modification date of the directory, so shadowing a cached `.pc` file is noticed too.
+    private func isValid(_ entry: Entry) -> Bool {
+        entry.dependencies.allSatisfy { dependency in
+            (try? self.modificationDate(of: dependency.path)) == dependency.modificationDate
+        }
+    }
+
+    private func modificationDate(of path: AbsolutePath) throws -> Double? {
+        guard self.fileSystem.exists(path) else {
+            return nil
+        }
+        return try self.fileSystem.getFileInfo(path).modTime.timeIntervalSince1970
+    }
+}
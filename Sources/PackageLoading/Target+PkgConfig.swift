@@ -45,7 +45,7 @@ public struct PkgConfigResult {
     }
 
     /// Create a result.
-    fileprivate init(
+    init(
         pkgConfigName: String,
         cFlags: [String] = [],
         libs: [String] = [],
@@ -68,6 +68,28 @@ public func pkgConfigArgs(
     brewPrefix: AbsolutePath? = .none,
     fileSystem: FileSystem,
     observabilityScope: ObservabilityScope
+) throws -> [PkgConfigResult] {
+    try pkgConfigArgs(
+        for: target,
+        pkgConfigDirectories: pkgConfigDirectories,
+        sdkRootPath: sdkRootPath,
+        brewPrefix: brewPrefix,
+        loadingContext: PkgConfig.LoadingContext(),
+        fileSystem: fileSystem,
+        observabilityScope: observabilityScope
+    )
+}
+
+/// Get pkgConfig result for a system library target, recording the pkg config files that were loaded and the
+/// paths searched for them in `loadingContext`.
+func pkgConfigArgs(
+    for target: SystemLibraryModule,
+    pkgConfigDirectories: [AbsolutePath],
+    sdkRootPath: AbsolutePath?,
+    brewPrefix: AbsolutePath?,
+    loadingContext: PkgConfig.LoadingContext,
+    fileSystem: FileSystem,
+    observabilityScope: ObservabilityScope
 ) throws -> [PkgConfigResult] {
     // If there is no pkg config name defined, we're done.
     guard let pkgConfigNames = target.pkgConfig else { return [] }
@@ -92,6 +114,7 @@ public func pkgConfigArgs(
                 name: pkgConfigName,
                 additionalSearchPaths: additionalSearchPaths,
                 brewPrefix: brewPrefix,
+                loadingContext: loadingContext,
                 fileSystem: fileSystem,
                 observabilityScope: observabilityScope
             )
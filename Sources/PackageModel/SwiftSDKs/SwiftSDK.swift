@@ -25,6 +25,9 @@ public enum SwiftSDKError: Swift.Error {
     /// A passed argument is neither a valid file system path nor a URL.
     case invalidPathOrURL(String)
 
+    /// Checksum of a bundle archive doesn't match the expected checksum.
+    case checksumMismatch(archivePath: AbsolutePath, expected: String, actual: String)
+
     /// Couldn't find the Xcode installation.
     case invalidInstallation(String)
 
@@ -71,6 +74,11 @@ extension SwiftSDKError: CustomStringConvertible {
             """
         case .invalidPathOrURL(let argument):
             return "`\(argument)` is neither a valid filesystem path nor a URL."
+        case .checksumMismatch(let archivePath, let expected, let actual):
+            return """
+            checksum of Swift SDK archive at `\(archivePath)` (\(actual)) does not match the expected checksum \
+            (\(expected)).
+            """
         case .invalidSchemaVersion:
             return "unsupported Swift SDK file schema version"
         case .invalidInstallation(let problem):
@@ -14,7 +14,10 @@
 @_spi(SwiftPMInternal)
 import Basics
 import struct Foundation.URL
+import struct TSCBasic.ByteString
 import protocol TSCBasic.FileSystem
+import protocol TSCBasic.HashAlgorithm
+import struct TSCBasic.SHA256
 import struct TSCBasic.RegEx
 import protocol TSCUtility.ProgressAnimationProtocol
 
@@ -22,6 +25,7 @@ public final class SwiftSDKBundleStore {
     public enum Output: Equatable, CustomStringConvertible {
         case downloadStarted(URL)
         case downloadFinishedSuccessfully(URL)
+        case reusingDownloadedArchive(URL)
         case unpackingArchive(bundlePathOrURL: String)
         case installationSuccessful(bundlePathOrURL: String, bundleName: String)
 
@@ -31,6 +35,8 @@ public final class SwiftSDKBundleStore {
                 return "Downloading a Swift SDK bundle archive from `\(url)`..."
             case let .downloadFinishedSuccessfully(url):
                 return "Swift SDK bundle archive successfully downloaded from `\(url)`."
+            case let .reusingDownloadedArchive(url):
+                return "Reusing a Swift SDK bundle archive previously downloaded from `\(url)`."
             case let .installationSuccessful(bundlePathOrURL, bundleName):
                 return "Swift SDK bundle at `\(bundlePathOrURL)` successfully installed as \(bundleName)."
             case let .unpackingArchive(bundlePathOrURL):
@@ -54,6 +60,10 @@ public final class SwiftSDKBundleStore {
         }
     }
 
+    /// Name of the directory in ``SwiftSDKBundleStore//swiftSDKsDirectory`` in which bundles are staged while they're
+    /// installed.
+    static let stagingDirectoryName = ".install-staging"
+
     /// Directory in which Swift SDKs bundles are stored.
     let swiftSDKsDirectory: AbsolutePath
 
@@ -139,32 +149,102 @@ public final class SwiftSDKBundleStore {
     }
 
     /// Installs a Swift SDK bundle from a given path or URL to ``SwiftSDKBundleStore//swiftSDKsDirectory``.
+    ///
+    /// Bundles are downloaded and unpacked in a staging directory next to the installed bundles, so that the
+    /// unpacked bundle can be moved into place with a single rename. The staging directory of a bundle is locked while
+    /// it's installed and is removed once the installation finishes, successfully or not. An archive that was fully
+    /// downloaded by an installation that was killed before it could clean up is reused by the next installation of the
+    /// same bundle if it matches the expected checksum.
     /// - Parameters:
     ///   - bundlePathOrURL: A string passed on the command line, which is either an absolute or relative to a current
     ///   working directory path, or a URL to a Swift SDK artifact bundle.
+    ///   - checksum: Expected SHA-256 checksum of the bundle archive, verified before unpacking it.
     ///   - archiver: Archiver instance to use for extracting bundle archives.
     public func install(
         bundlePathOrURL: String,
+        checksum: String? = nil,
         _ archiver: any Archiver,
         _ httpClient: HTTPClient = .init()
     ) async throws {
-        let bundleName = try await withTemporaryDirectory(fileSystem: self.fileSystem, removeTreeOnDeinit: true) { temporaryDirectory in
-            let bundlePath: AbsolutePath
+        let stagingDirectory = self.stagingDirectory(for: bundlePathOrURL)
+
+        // Concurrent installations of the same bundle would share the staging directory, so it's locked for the whole
+        // installation. Only the directory of this bundle is removed afterwards: the staging root is shared with
+        // installations of other bundles, which may be creating their own directories in it concurrently.
+        let bundleName: String = try await safe_async { completion in
+            completion(Result {
+                // The lock file is created next to the staging directory.
+                try self.fileSystem.createDirectory(stagingDirectory.parentDirectory, recursive: true)
+                return try self.fileSystem.withLock(on: stagingDirectory, type: .exclusive) {
+                    defer { try? self.fileSystem.removeFileTree(stagingDirectory) }
+
+                    return try temp_await { (completion: @escaping (Result<String, Error>) -> Void) in
+                        Task {
+                            do {
+                                completion(.success(try await self.stage(
+                                    bundlePathOrURL: bundlePathOrURL,
+                                    checksum: checksum,
+                                    stagingDirectory: stagingDirectory,
+                                    archiver: archiver,
+                                    httpClient: httpClient
+                                )))
+                            } catch {
+                                completion(.failure(error))
+                            }
+                        }
+                    }
+                }
+            })
+        }
+
+        self.outputHandler(.installationSuccessful(bundlePathOrURL: bundlePathOrURL, bundleName: bundleName))
+    }
+
+    /// Returns the staging directory used for installing the bundle at a given path or URL. The directory is on the
+    /// same file system as installed bundles and its name is stable across installation attempts.
+    private func stagingDirectory(for bundlePathOrURL: String) -> AbsolutePath {
+        let key = TSCBasic.SHA256().hash(ByteString(encodingAsUTF8: bundlePathOrURL)).hexadecimalRepresentation
+        return self.swiftSDKsDirectory.appending(components: Self.stagingDirectoryName, key)
+    }
 
-            if
-                let bundleURL = URL(string: bundlePathOrURL),
-                let scheme = bundleURL.scheme,
-                scheme == "http" || scheme == "https"
+    /// Downloads the bundle if needed, then unpacks, validates and installs it from `stagingDirectory`.
+    /// - Returns: Name of the bundle installed.
+    private func stage(
+        bundlePathOrURL: String,
+        checksum: String?,
+        stagingDirectory: AbsolutePath,
+        archiver: any Archiver,
+        httpClient: HTTPClient
+    ) async throws -> String {
+        let bundlePath: AbsolutePath
+        var isChecksumVerified = false
+
+        if
+            let bundleURL = URL(string: bundlePathOrURL),
+            let scheme = bundleURL.scheme,
+            scheme == "http" || scheme == "https"
+        {
+            let bundleName: String
+            let fileNameComponent = bundleURL.lastPathComponent
+            if archiver.supportedExtensions.contains(where: { fileNameComponent.hasSuffix($0) }) {
+                bundleName = fileNameComponent
+            } else {
+                // Assume that the bundle is a tarball if it doesn't have a recognized extension.
+                bundleName = "bundle.tar.gz"
+            }
+            let downloadDirectory = stagingDirectory.appending(component: "download")
+            let downloadedBundlePath = downloadDirectory.appending(component: bundleName)
+
+            // The archive is only moved to its destination once the download completes, so an existing archive was
+            // fully downloaded by an installation that was killed. It's only trusted if it has the expected checksum.
+            if let checksum, self.fileSystem.isFile(downloadedBundlePath),
+               (try? self.verifyChecksum(checksum, ofArchiveAt: downloadedBundlePath)) != nil
             {
-                let bundleName: String
-                let fileNameComponent = bundleURL.lastPathComponent
-                if archiver.supportedExtensions.contains(where: { fileNameComponent.hasSuffix($0) }) {
-                    bundleName = fileNameComponent
-                } else {
-                    // Assume that the bundle is a tarball if it doesn't have a recognized extension.
-                    bundleName = "bundle.tar.gz"
-                }
-                let downloadedBundlePath = temporaryDirectory.appending(component: bundleName)
+                isChecksumVerified = true
+                self.outputHandler(.reusingDownloadedArchive(bundleURL))
+            } else {
+                try self.fileSystem.removeFileTree(downloadDirectory)
+                try self.fileSystem.createDirectory(downloadDirectory, recursive: true)
 
                 var request = HTTPClientRequest.download(
                     url: bundleURL,
@@ -193,40 +273,57 @@ public final class SwiftSDKBundleStore {
                 )
                 self.downloadProgressAnimation?.complete(success: true)
 
-                bundlePath = downloadedBundlePath
-
                 self.outputHandler(.downloadFinishedSuccessfully(bundleURL))
-            } else if
-                let cwd: AbsolutePath = self.fileSystem.currentWorkingDirectory,
-                let originalBundlePath = try? AbsolutePath(validating: bundlePathOrURL, relativeTo: cwd)
-            {
-                bundlePath = originalBundlePath
-            } else {
-                throw SwiftSDKError.invalidPathOrURL(bundlePathOrURL)
             }
 
-            return try await self.installIfValid(
-                bundlePathOrURL: bundlePathOrURL,
-                validatedBundlePath: bundlePath,
-                temporaryDirectory: temporaryDirectory,
-                archiver: archiver
-            )
-        }.value
+            bundlePath = downloadedBundlePath
+        } else if
+            let cwd: AbsolutePath = self.fileSystem.currentWorkingDirectory,
+            let originalBundlePath = try? AbsolutePath(validating: bundlePathOrURL, relativeTo: cwd)
+        {
+            bundlePath = originalBundlePath
+        } else {
+            throw SwiftSDKError.invalidPathOrURL(bundlePathOrURL)
+        }
 
-        self.outputHandler(.installationSuccessful(bundlePathOrURL: bundlePathOrURL, bundleName: bundleName))
+        if let checksum, !isChecksumVerified {
+            try self.verifyChecksum(checksum, ofArchiveAt: bundlePath)
+        }
+
+        return try await self.installIfValid(
+            bundlePathOrURL: bundlePathOrURL,
+            validatedBundlePath: bundlePath,
+            stagingDirectory: stagingDirectory,
+            archiver: archiver
+        )
+    }
+
+    private func verifyChecksum(_ expectedChecksum: String, ofArchiveAt archivePath: AbsolutePath) throws {
+        guard self.fileSystem.isFile(archivePath) else {
+            throw SwiftSDKError.invalidBundleArchive(archivePath)
+        }
+        let actualChecksum = try TSCBasic.SHA256().hash(self.fileSystem.readFileContents(archivePath))
+            .hexadecimalRepresentation
+        guard actualChecksum == expectedChecksum.lowercased() else {
+            throw SwiftSDKError.checksumMismatch(
+                archivePath: archivePath,
+                expected: expectedChecksum,
+                actual: actualChecksum
+            )
+        }
     }
 
     /// Unpacks a Swift SDK bundle if it has an archive extension in its filename.
     /// - Parameters:
     ///   - bundlePath: Absolute path to a Swift SDK bundle to unpack if needed.
-    ///   - temporaryDirectory: Absolute path to a temporary directory in which the bundle can be unpacked if needed.
+    ///   - stagingDirectory: Absolute path to a staging directory in which the bundle can be unpacked if needed.
     ///   - archiver: Archiver instance to use for extracting bundle archives.
     /// - Returns: Path to an unpacked Swift SDK bundle if unpacking is needed, value of `bundlePath` is returned
     /// otherwise.
     private func unpackIfNeeded(
         bundlePathOrURL: String,
         validatedBundlePath bundlePath: AbsolutePath,
-        temporaryDirectory: AbsolutePath,
+        stagingDirectory: AbsolutePath,
         _ archiver: any Archiver
     ) async throws -> AbsolutePath {
         // If there's no archive extension on the bundle name, assuming it's not archived and returning the same path.
@@ -235,8 +332,10 @@ public final class SwiftSDKBundleStore {
         }
 
         self.outputHandler(.unpackingArchive(bundlePathOrURL: bundlePathOrURL))
-        let extractionResultsDirectory = temporaryDirectory.appending("extraction-results")
-        try self.fileSystem.createDirectory(extractionResultsDirectory)
+        let extractionResultsDirectory = stagingDirectory.appending("extraction")
+        // Discard anything left over by an interrupted extraction.
+        try self.fileSystem.removeFileTree(extractionResultsDirectory)
+        try self.fileSystem.createDirectory(extractionResultsDirectory, recursive: true)
 
         try await archiver.extract(from: bundlePath, to: extractionResultsDirectory)
 
@@ -258,13 +357,13 @@ public final class SwiftSDKBundleStore {
     /// Installs an unpacked Swift SDK bundle to a Swift SDK installation directory.
     /// - Parameters:
     ///   - bundlePath: absolute path to an unpacked Swift SDK bundle directory.
-    ///   - temporaryDirectory: Temporary directory to use if the bundle is an archive that needs extracting.
+    ///   - stagingDirectory: Staging directory to use if the bundle is an archive that needs extracting.
     ///   - archiver: Archiver instance to use for extracting bundle archives.
     /// - Returns: Name of the bundle installed.
     private func installIfValid(
         bundlePathOrURL: String,
         validatedBundlePath: AbsolutePath,
-        temporaryDirectory: AbsolutePath,
+        stagingDirectory: AbsolutePath,
         archiver: any Archiver
     ) async throws -> String {
         #if os(macOS)
@@ -277,7 +376,7 @@ public final class SwiftSDKBundleStore {
         let unpackedBundlePath = try await self.unpackIfNeeded(
             bundlePathOrURL: bundlePathOrURL,
             validatedBundlePath: validatedBundlePath,
-            temporaryDirectory: temporaryDirectory,
+            stagingDirectory: stagingDirectory,
             archiver
         )
 
@@ -307,7 +406,22 @@ public final class SwiftSDKBundleStore {
             }
         }
 
-        try self.fileSystem.copy(from: unpackedBundlePath, to: installedBundlePath)
+        guard !self.fileSystem.exists(installedBundlePath) else {
+            throw SwiftSDKError.swiftSDKBundleAlreadyInstalled(bundleName: bundleName)
+        }
+
+        if unpackedBundlePath.isDescendant(of: stagingDirectory) {
+            // Unpacked bundles are on the same file system, so this is a rename.
+            try self.fileSystem.move(from: unpackedBundlePath, to: installedBundlePath)
+        } else {
+            // Copy bundles that weren't archived to the staging directory first, so that a partial copy is never
+            // visible as an installed bundle.
+            let stagedBundlePath = stagingDirectory.appending(components: "extraction", bundleName)
+            try self.fileSystem.removeFileTree(stagedBundlePath.parentDirectory)
+            try self.fileSystem.createDirectory(stagedBundlePath.parentDirectory, recursive: true)
+            try self.fileSystem.copy(from: unpackedBundlePath, to: stagedBundlePath)
+            try self.fileSystem.move(from: stagedBundlePath, to: installedBundlePath)
+        }
 
         return bundleName
     }
@@ -319,6 +319,25 @@ public final class UserToolchain: Toolchain {
         #endif
     }
 
+    /// Returns the path to the linker of the given flavor (e.g. `lld` or `mold`) if it's installed next to the
+    /// compiler or in the search paths, i.e. if `-use-ld=<flavor>` would be able to find it.
+    public func findLinker(flavor: String) -> AbsolutePath? {
+        try? UserToolchain.getTool(
+            "ld.\(flavor)",
+            binDirectories: [self.swiftCompilerPath.parentDirectory] + self.envSearchPaths,
+            fileSystem: self.fileSystem
+        )
+    }
+
+    /// Returns the path to `llvm-dwp` if it's installed next to the compiler or in the search paths.
+    public func findDWARFPackager() -> AbsolutePath? {
+        try? UserToolchain.getTool(
+            "llvm-dwp",
+            binDirectories: [self.swiftCompilerPath.parentDirectory] + self.envSearchPaths,
+            fileSystem: self.fileSystem
+        )
+    }
+
     /// Returns the path to lldb.
     public func getLLDB() throws -> AbsolutePath {
         // Look for LLDB next to the compiler first.
@@ -48,11 +48,7 @@ public struct AddPackageDependency {
             dependency, to: packageCall
         )
 
-        return PackageEditResult(
-            manifestEdits: [
-                .replace(packageCall, with: newPackageCall.description)
-            ]
-        )
+        return PackageEditResult(replacing: packageCall, with: newPackageCall)
     }
 
     /// Implementation of adding a package dependency to an existing call.
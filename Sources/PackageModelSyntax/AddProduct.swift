@@ -49,10 +49,6 @@ public struct AddProduct {
             newElement: product.asSyntax()
         )
 
-        return PackageEditResult(
-            manifestEdits: [
-                .replace(packageCall, with: newPackageCall.description)
-            ]
-        )
+        return PackageEditResult(replacing: packageCall, with: newPackageCall)
     }
 }
@@ -106,11 +106,7 @@ public struct AddTarget {
         }
 
         guard let outerDirectory else {
-            return PackageEditResult(
-                manifestEdits: [
-                    .replace(packageCall, with: newPackageCall.description)
-                ]
-            )
+            return PackageEditResult(replacing: packageCall, with: newPackageCall)
         }
 
         let outerPath = try RelativePath(validating: outerDirectory)
@@ -177,12 +173,18 @@ public struct AddTarget {
         default: break;
         }
 
-        return PackageEditResult(
-            manifestEdits: [
-                .replace(packageCall, with: newPackageCall.description)
-            ] + extraManifestEdits,
+        // The import is inserted rather than replacing a node, so only the
+        // package call can be applied to the syntax tree directly.
+        var result = PackageEditResult(
+            replacing: packageCall,
+            with: newPackageCall,
             auxiliaryFiles: auxiliaryFiles
         )
+        if !extraManifestEdits.isEmpty {
+            result.manifestEdits += extraManifestEdits
+            result.manifestReplacements = nil
+        }
+        return result
     }
 
     /// Add the primary source file for a target to the list of auxiliary
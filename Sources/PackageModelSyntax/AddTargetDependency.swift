@@ -81,11 +81,7 @@ public struct AddTargetDependency {
             dependency, to: targetCall
         )
 
-        return PackageEditResult(
-            manifestEdits: [
-                .replace(targetCall, with: newTargetCall.description)
-            ]
-        )
+        return PackageEditResult(replacing: targetCall, with: newTargetCall)
     }
 
     /// Implementation of adding a target dependency to an existing call.
@@ -10,6 +10,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+import Basics
 import PackageLoading
 import PackageModel
 import SwiftSyntax
@@ -22,6 +23,12 @@ package enum ManifestEditError: Error {
     case cannotFindTarget(targetName: String)
     case cannotFindArrayLiteralArgument(argumentName: String, node: Syntax)
     case oldManifest(ToolsVersion)
+    case duplicatePackageDependency(PackageIdentity)
+    case duplicateProduct(productName: String)
+    case duplicateTarget(targetName: String)
+    case duplicateTargetDependency(dependencyName: String, targetName: String)
+    case conflictingAuxiliaryFile(RelativePath)
+    case manifestModified(AbsolutePath)
 }
 
 extension ToolsVersion {
@@ -43,6 +50,18 @@ extension ManifestEditError: CustomStringConvertible {
             "unable to find array literal for '\(name)' argument"
         case .oldManifest(let version):
             "package manifest version \(version) is too old: please update to manifest version \(ToolsVersion.minimumManifestEditVersion) or newer"
+        case .duplicatePackageDependency(let identity):
+            "package already depends on '\(identity)'"
+        case .duplicateProduct(productName: let name):
+            "package already has a product named '\(name)'"
+        case .duplicateTarget(targetName: let name):
+            "package already has a target named '\(name)'"
+        case .duplicateTargetDependency(dependencyName: let dependencyName, targetName: let targetName):
+            "target '\(targetName)' already depends on '\(dependencyName)'"
+        case .conflictingAuxiliaryFile(let path):
+            "more than one edit creates '\(path)'"
+        case .manifestModified(let path):
+            "package manifest at \(path) was modified while it was being edited"
         }
     }
 }
@@ -0,0 +1,255 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import Basics
+import PackageModel
+@_spi(FixItApplier) import SwiftIDEUtils
+import SwiftParser
+import SwiftSyntax
+
+import struct TSCBasic.ByteString
+
+/// A single edit of a package manifest.
+public enum ManifestEdit {
+    case addPackageDependency(PackageDependency)
+    case addProduct(ProductDescription)
+    case addTarget(
+        TargetDescription,
+        configuration: AddTarget.Configuration = .init(),
+        installedSwiftPMConfiguration: InstalledSwiftPMConfiguration = .default
+    )
+    case addTargetDependency(TargetDescription.Dependency, targetName: String)
+}
+
+/// A batch of edits to one or more package manifests that are applied
+/// together.
+///
+/// Each manifest is read and parsed once, no matter how many edits apply to
+/// it. Edits are applied to the syntax tree in memory, and an edit that adds
+/// something the manifest already has, including something added by an
+/// earlier edit of the batch, is rejected. Nothing is written until
+/// `commit(verbose:)` is called, so a failing edit leaves every manifest
+/// untouched.
+public struct ManifestEditTransaction {
+    private struct EditedManifest {
+        /// The contents of the manifest when it was read.
+        let originalContents: ByteString
+
+        /// The manifest with all edits applied so far.
+        var syntax: SourceFileSyntax
+
+        /// The auxiliary files created by the edits, relative to the package.
+        var auxiliaryFiles: [(RelativePath, SourceFileSyntax)] = []
+    }
+
+    private let fileSystem: any FileSystem
+    private var manifests: [AbsolutePath: EditedManifest] = [:]
+
+    /// The paths of the manifests edited so far.
+    public private(set) var manifestPaths: [AbsolutePath] = []
+
+    public init(fileSystem: any FileSystem) {
+        self.fileSystem = fileSystem
+    }
+
+    /// Apply `edit` to the manifest at `manifestPath` in memory.
+    ///
+    /// If the edit fails, the transaction is left as it was before.
+    public mutating func apply(_ edit: ManifestEdit, toManifestAt manifestPath: AbsolutePath) throws {
+        var manifest = try self.manifests[manifestPath] ?? self.loadManifest(at: manifestPath)
+
+        try Self.checkForConflicts(edit, in: manifest.syntax)
+
+        let result: PackageEditResult
+        switch edit {
+        case .addPackageDependency(let dependency):
+            result = try AddPackageDependency.addPackageDependency(dependency, to: manifest.syntax)
+        case .addProduct(let product):
+            result = try AddProduct.addProduct(product, to: manifest.syntax)
+        case .addTarget(let target, let configuration, let installedSwiftPMConfiguration):
+            result = try AddTarget.addTarget(
+                target,
+                to: manifest.syntax,
+                configuration: configuration,
+                installedSwiftPMConfiguration: installedSwiftPMConfiguration
+            )
+        case .addTargetDependency(let dependency, let targetName):
+            result = try AddTargetDependency.addTargetDependency(
+                dependency,
+                targetName: targetName,
+                to: manifest.syntax
+            )
+        }
+
+        for (path, _) in result.auxiliaryFiles where manifest.auxiliaryFiles.contains(where: { $0.0 == path }) {
+            throw ManifestEditError.conflictingAuxiliaryFile(path)
+        }
+        manifest.auxiliaryFiles += result.auxiliaryFiles
+
+        if let replacements = result.manifestReplacements {
+            for (original, replacement) in replacements {
+                manifest.syntax = manifest.syntax.replacingChild(original, with: replacement)
+            }
+        } else {
+            // Edits that aren't node replacements can only be applied to the
+            // source text.
+            manifest.syntax = Parser.parse(
+                source: FixItApplier.apply(edits: result.manifestEdits, to: manifest.syntax)
+            )
+        }
+
+        if self.manifests.updateValue(manifest, forKey: manifestPath) == nil {
+            self.manifestPaths.append(manifestPath)
+        }
+    }
+
+    /// Write the edited manifests and the auxiliary files created by the
+    /// edits.
+    ///
+    /// Fails without writing anything if one of the manifests was modified
+    /// since it was read. If writing one of the manifests fails, the ones
+    /// written before it are restored, so either every manifest is updated or
+    /// none is. Auxiliary files are only written once every manifest is.
+    public func commit(verbose: Bool) throws {
+        let manifests = self.manifestPaths.map { ($0, self.manifests[$0]!) }
+        for (manifestPath, manifest) in manifests {
+            guard (try? self.fileSystem.readFileContents(manifestPath)) == manifest.originalContents else {
+                throw ManifestEditError.manifestModified(manifestPath)
+            }
+        }
+
+        var writtenManifests: [(AbsolutePath, EditedManifest)] = []
+        do {
+            for (manifestPath, manifest) in manifests {
+                if verbose {
+                    let relativePath = manifestPath.relative(to: manifestPath.parentDirectory)
+                    print("Updating package manifest at \(relativePath)...", terminator: "")
+                }
+                try self.fileSystem.writeFileContents(
+                    manifestPath,
+                    bytes: ByteString(encodingAsUTF8: manifest.syntax.description),
+                    atomically: true
+                )
+                writtenManifests.append((manifestPath, manifest))
+                if verbose {
+                    print(" done.")
+                }
+            }
+        } catch {
+            for (manifestPath, manifest) in writtenManifests {
+                try? self.fileSystem.writeFileContents(manifestPath, bytes: manifest.originalContents, atomically: true)
+            }
+            throw error
+        }
+
+        for (manifestPath, manifest) in manifests {
+            try PackageEditResult.writeAuxiliaryFiles(
+                manifest.auxiliaryFiles,
+                to: self.fileSystem,
+                rootPath: manifestPath.parentDirectory,
+                verbose: verbose
+            )
+        }
+    }
+
+    private func loadManifest(at manifestPath: AbsolutePath) throws -> EditedManifest {
+        let contents: ByteString
+        do {
+            contents = try self.fileSystem.readFileContents(manifestPath)
+        } catch {
+            throw StringError("cannot find package manifest in \(manifestPath)")
+        }
+
+        let syntax = contents.withData { data in
+            data.withUnsafeBytes { buffer in
+                buffer.withMemoryRebound(to: UInt8.self) { buffer in
+                    Parser.parse(source: buffer)
+                }
+            }
+        }
+        return EditedManifest(originalContents: contents, syntax: syntax)
+    }
+
+    /// Check that `edit` doesn't add something that `manifest` already has.
+    private static func checkForConflicts(_ edit: ManifestEdit, in manifest: SourceFileSyntax) throws {
+        guard let packageCall = manifest.findCall(calleeName: "Package") else {
+            throw ManifestEditError.cannotFindPackage
+        }
+
+        switch edit {
+        case .addPackageDependency(let dependency):
+            let identities = packageCall.arrayArgumentCalls(labeled: "dependencies").compactMap { call -> PackageIdentity? in
+                if let location = call.stringLiteralArgument(labeled: "url") ?? call.stringLiteralArgument(labeled: "path") {
+                    return PackageIdentity(urlString: location)
+                }
+                return call.stringLiteralArgument(labeled: "id").map { PackageIdentity.plain($0) }
+            }
+            if identities.contains(dependency.identity) {
+                throw ManifestEditError.duplicatePackageDependency(dependency.identity)
+            }
+
+        case .addProduct(let product):
+            let names = packageCall.arrayArgumentCalls(labeled: "products").map { $0.stringLiteralArgument(labeled: "name") }
+            if names.contains(product.name) {
+                throw ManifestEditError.duplicateProduct(productName: product.name)
+            }
+
+        case .addTarget(let target, _, _):
+            let names = packageCall.arrayArgumentCalls(labeled: "targets").map { $0.stringLiteralArgument(labeled: "name") }
+            if names.contains(target.name) {
+                throw ManifestEditError.duplicateTarget(targetName: target.name)
+            }
+
+        case .addTargetDependency(let dependency, let targetName):
+            let targetCall = packageCall.arrayArgumentCalls(labeled: "targets").first {
+                $0.stringLiteralArgument(labeled: "name") == targetName
+            }
+            guard let dependencies = targetCall?.findArgument(labeled: "dependencies")?.expression.findArrayArgument()
+            else {
+                // Either there are no dependencies yet, or adding the
+                // dependency will report what's wrong with the target.
+                return
+            }
+            let dependencyName: String
+            switch dependency {
+            case .target(let name, _), .product(let name, _, _, _), .byName(let name, _):
+                dependencyName = name
+            }
+            let names = dependencies.elements.map { element in
+                element.expression.as(StringLiteralExprSyntax.self)?.representedLiteralValue
+                    ?? element.expression.as(FunctionCallExprSyntax.self)?.stringLiteralArgument(labeled: "name")
+            }
+            if names.contains(dependencyName) {
+                throw ManifestEditError.duplicateTargetDependency(
+                    dependencyName: dependencyName,
+                    targetName: targetName
+                )
+            }
+        }
+    }
+}
+
+extension FunctionCallExprSyntax {
+    /// The value of the argument with the given label, if it is a string
+    /// literal.
+    fileprivate func stringLiteralArgument(labeled label: String) -> String? {
+        self.findArgument(labeled: label)?.expression.as(StringLiteralExprSyntax.self)?.representedLiteralValue
+    }
+
+    /// The calls in the array literal of the argument with the given label.
+    fileprivate func arrayArgumentCalls(labeled label: String) -> [FunctionCallExprSyntax] {
+        guard let array = self.findArgument(labeled: label)?.expression.findArrayArgument() else {
+            return []
+        }
+        return array.elements.compactMap { $0.expression.as(FunctionCallExprSyntax.self) }
+    }
+}
@@ -22,6 +22,27 @@ public struct PackageEditResult {
 
     /// Auxiliary files to write.
     public var auxiliaryFiles: [(RelativePath, SourceFileSyntax)] = []
+
+    /// The manifest edits as replacements of syntax nodes of the manifest, if
+    /// all of them can be expressed that way. This lets a series of edits be
+    /// applied to the syntax tree without parsing the manifest again after
+    /// each of them.
+    var manifestReplacements: [(original: Syntax, replacement: Syntax)]?
+}
+
+extension PackageEditResult {
+    /// Create an edit result that replaces a node of the manifest.
+    init(
+        replacing original: some SyntaxProtocol,
+        with replacement: some SyntaxProtocol,
+        auxiliaryFiles: [(RelativePath, SourceFileSyntax)] = []
+    ) {
+        self.init(
+            manifestEdits: [.replace(original, with: replacement.description)],
+            auxiliaryFiles: auxiliaryFiles,
+            manifestReplacements: [(Syntax(original), Syntax(replacement))]
+        )
+    }
 }
 
 extension PackageEditResult {
@@ -53,6 +74,22 @@ extension PackageEditResult {
         }
 
         // Write all of the auxiliary files.
+        try Self.writeAuxiliaryFiles(
+            auxiliaryFiles,
+            to: filesystem,
+            rootPath: rootPath,
+            verbose: verbose
+        )
+    }
+
+    /// Write auxiliary files of the package at `rootPath`, skipping the ones
+    /// that already exist.
+    static func writeAuxiliaryFiles(
+        _ auxiliaryFiles: [(RelativePath, SourceFileSyntax)],
+        to filesystem: any FileSystem,
+        rootPath: AbsolutePath,
+        verbose: Bool
+    ) throws {
         for (auxiliaryFileRelPath, auxiliaryFileSyntax) in auxiliaryFiles {
             // If the file already exists, skip it.
             let filePath = rootPath.appending(auxiliaryFileRelPath)
@@ -93,5 +130,4 @@ extension PackageEditResult {
             }
         }
     }
-
 }
@@ -409,7 +409,7 @@ fileprivate class ReplacingRewriter: SyntaxRewriter {
     }
 }
 
-fileprivate extension SyntaxProtocol {
+extension SyntaxProtocol {
     /// Replace the given child with a new child node.
     func replacingChild(_ childNode: Syntax, with newChildNode: Syntax) -> Self {
         return ReplacingRewriter(
@@ -181,6 +181,8 @@ public class RegistryDownloadsManager: Cancellable {
                         // copy the package from the cache into the package path.
                         try self.fileSystem.createDirectory(packagePath.parentDirectory, recursive: true)
                         try self.fileSystem.copy(from: cachedPackagePath, to: packagePath)
+                        try? CacheAccessRecord(cacheDirectory: cachePath, fileSystem: self.fileSystem)
+                            .recordAccess(to: relativePath)
                         completion(.success(.init(fromCache: true, updatedCache: false)))
                     } else {
                         // it is possible that we already created the directory before from failed attempts, so clear leftover data if present.
@@ -203,6 +205,8 @@ public class RegistryDownloadsManager: Cancellable {
                                 // copy the package from the cache into the package path.
                                 try self.fileSystem.createDirectory(packagePath.parentDirectory, recursive: true)
                                 try self.fileSystem.copy(from: cachedPackagePath, to: packagePath)
+                                try? CacheAccessRecord(cacheDirectory: cachePath, fileSystem: self.fileSystem)
+                                    .recordAccess(to: relativePath)
                                 return FetchDetails(fromCache: true, updatedCache: true)
                             })
                         }
@@ -10,6 +10,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+import struct Basics.AbsolutePath
 import struct Basics.Triple
 import enum PackageModel.BuildConfiguration
 
@@ -19,10 +20,21 @@ extension BuildParameters {
             debugInfoFormat: DebugInfoFormat = .dwarf,
             triple: Triple,
             shouldEnableDebuggingEntitlement: Bool,
-            omitFramePointers: Bool?
+            omitFramePointers: Bool?,
+            shouldSplitDWARF: Bool = false,
+            dwarfPackagerPath: AbsolutePath? = nil,
+            shouldCompressDebugSections: Bool = false,
+            pathPrefixMappings: [PathPrefixMapping] = []
         ) {
             self.debugInfoFormat = debugInfoFormat
 
+            // Split DWARF and compressed debug sections are ELF features.
+            let supportsELFDebugInfoLayout = triple.isLinux() && debugInfoFormat == .dwarf
+            self.shouldSplitDWARF = supportsELFDebugInfoLayout && shouldSplitDWARF
+            self.dwarfPackagerPath = self.shouldSplitDWARF ? dwarfPackagerPath : nil
+            self.shouldCompressDebugSections = supportsELFDebugInfoLayout && shouldCompressDebugSections
+            self.pathPrefixMappings = pathPrefixMappings
+
             // Per rdar://112065568 for backtraces to work on macOS a special entitlement needs to be granted on the final
             // executable.
             self.shouldEnableDebuggingEntitlement = triple.isMacOSX && shouldEnableDebuggingEntitlement
@@ -48,6 +60,42 @@ extension BuildParameters {
 
         /// Whether to omit frame pointers
         public var omitFramePointers: Bool?
+
+        /// Whether DWARF emitted for C-family sources should be split into `.dwo` files next to the objects, which
+        /// keeps it out of the linked binaries. Only applies to ELF platforms.
+        public var shouldSplitDWARF: Bool
+
+        /// Path to `llvm-dwp`, used to package the `.dwo` files referenced by each linked product into a single
+        /// `.dwp` file next to it. The `.dwo` files are left unpackaged if `nil`.
+        public var dwarfPackagerPath: AbsolutePath?
+
+        /// Whether debug sections should be compressed in objects and linked binaries. Only applies to ELF
+        /// platforms.
+        public var shouldCompressDebugSections: Bool
+
+        /// The path prefixes to remap in debug info, coverage mappings and file name macros, so that objects don't
+        /// depend on where the package and the scratch directory are located. Index data, the build manifest and the
+        /// build database keep absolute paths.
+        public var pathPrefixMappings: [PathPrefixMapping]
+    }
+
+    /// A remapping of an absolute path prefix in compiler outputs.
+    public struct PathPrefixMapping: Encodable, Equatable {
+        /// The prefix to remap.
+        public var path: AbsolutePath
+
+        /// What the prefix is replaced with, usually a relative path.
+        public var replacement: String
+
+        public init(path: AbsolutePath, replacement: String) {
+            self.path = path
+            self.replacement = replacement
+        }
+
+        /// The mapping in the `<prefix>=<replacement>` form compilers take.
+        public var argument: String {
+            "\(self.path.pathString)=\(self.replacement)"
+        }
     }
 
     /// Represents the debugging strategy.
@@ -26,6 +26,7 @@ extension BuildParameters {
             explicitTargetDependencyImportCheckingMode: TargetDependencyImportCheckingMode = .none,
             useIntegratedSwiftDriver: Bool = false,
             useExplicitModuleBuild: Bool = false,
+            useIsolatedModuleSearchPaths: Bool = false,
             isPackageAccessModifierSupported: Bool = false
         ) {
             self.canRenameEntrypointFunctionName = canRenameEntrypointFunctionName
@@ -33,6 +34,7 @@ extension BuildParameters {
             self.explicitTargetDependencyImportCheckingMode = explicitTargetDependencyImportCheckingMode
             self.useIntegratedSwiftDriver = useIntegratedSwiftDriver
             self.useExplicitModuleBuild = useExplicitModuleBuild
+            self.useIsolatedModuleSearchPaths = useIsolatedModuleSearchPaths
             self.isPackageAccessModifierSupported = isPackageAccessModifierSupported
         }
 
@@ -54,6 +56,10 @@ extension BuildParameters {
         /// Whether to use the explicit module build flow (with the integrated driver).
         public var useExplicitModuleBuild: Bool
 
+        /// Whether each Swift module should only see the modules of its declared dependencies, instead of
+        /// searching the modules directory shared by all modules of the build.
+        public var useIsolatedModuleSearchPaths: Bool
+
         /// Whether the version of Swift Driver used in the currently selected toolchain
         /// supports `-package-name` options.
         @_spi(SwiftPMInternal)
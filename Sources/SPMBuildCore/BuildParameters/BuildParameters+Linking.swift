@@ -37,6 +37,17 @@ extension BuildParameters {
         case thin
     }
 
+    /// A linker to use instead of the toolchain's default on platforms which allow selecting one, passed to the
+    /// Swift driver with `-use-ld=`.
+    ///
+    /// Both `lld` and `mold` link large binaries considerably faster than the system linker, in parts because they
+    /// make use of all available cores.
+    public enum Linker: String, Encodable {
+        case lld
+        case mold
+        case gold
+    }
+
     /// Build parameters related to linking grouped in a single type to aggregate those in one place.
     public struct Linking: Encodable {
         /// Whether to disable dead code stripping by the linker
@@ -50,16 +61,45 @@ extension BuildParameters {
         /// If should link the Swift stdlib statically.
         public var shouldLinkStaticSwiftStdlib: Bool
 
+        /// The linker to use, `nil` if the toolchain's default linker should be used.
+        public var linker: Linker?
+
+        /// The number of threads the linker may use, `nil` to use the linker's default.
+        public var linkerThreads: Int?
+
+        /// Whether static library products of debug builds should be created as thin archives, which only
+        /// reference the objects they contain instead of copying them. Thin archives can't be moved away from the
+        /// build directory, so full archives are always created for release builds.
+        public var shouldUseThinArchives: Bool
+
+        /// Whether building everything links the snippets of the root packages. Snippets are always compiled, but
+        /// when this is `false` each one is only linked into an executable when it is built or run on its own.
+        public var shouldLinkSnippets: Bool
+
+        /// The number of products that may be linked at once, `nil` if they are only limited by the number of build
+        /// jobs. Linking large binaries takes a lot of memory, so linking many of them at once can exhaust it.
+        public var maxConcurrentLinkJobs: Int?
+
         public init(
             linkerDeadStrip: Bool = true,
             linkTimeOptimizationMode: LinkTimeOptimizationMode? = nil,
             shouldDisableLocalRpath: Bool = false,
-            shouldLinkStaticSwiftStdlib: Bool = false
+            shouldLinkStaticSwiftStdlib: Bool = false,
+            linker: Linker? = nil,
+            linkerThreads: Int? = nil,
+            shouldUseThinArchives: Bool = false,
+            shouldLinkSnippets: Bool = true,
+            maxConcurrentLinkJobs: Int? = nil
         ) {
             self.linkerDeadStrip = linkerDeadStrip
             self.linkTimeOptimizationMode = linkTimeOptimizationMode
             self.shouldDisableLocalRpath = shouldDisableLocalRpath
             self.shouldLinkStaticSwiftStdlib = shouldLinkStaticSwiftStdlib
+            self.linker = linker
+            self.linkerThreads = linkerThreads
+            self.shouldUseThinArchives = shouldUseThinArchives
+            self.shouldLinkSnippets = shouldLinkSnippets
+            self.maxConcurrentLinkJobs = maxConcurrentLinkJobs
         }
     }
 }
@@ -558,6 +558,38 @@ public final class GitRepository: Repository, WorkingCheckout {
         try Revision(identifier: self.resolveHash(treeish: identifier, type: "commit").bytes.description)
     }
 
+    public func resolveTagRevisions() throws -> [String: Revision] {
+        // `show-ref` fails if there are no tags.
+        guard try !self.getTags().isEmpty else {
+            return [:]
+        }
+        let output = try self.lock.withLock {
+            try callGit(
+                "show-ref",
+                "--tags",
+                "--dereference",
+                failureMessage: "Couldn’t resolve the revisions of the tags"
+            )
+        }
+
+        var revisions = [String: Revision]()
+        for line in output.split(whereSeparator: { $0.isNewline }) {
+            let fields = line.split(separator: " ", maxSplits: 1)
+            guard fields.count == 2, fields[1].hasPrefix("refs/tags/") else {
+                continue
+            }
+            let revision = Revision(identifier: String(fields[0]))
+            let ref = fields[1].dropFirst("refs/tags/".count)
+            if ref.hasSuffix("^{}") {
+                // An annotated tag is followed by the commit it points to.
+                revisions[String(ref.dropLast("^{}".count))] = revision
+            } else if revisions[String(ref)] == nil {
+                revisions[String(ref)] = revision
+            }
+        }
+        return revisions
+    }
+
     public func fetch() throws {
         try self.fetch(progress: nil)
     }
@@ -177,6 +177,12 @@ public protocol Repository {
     /// - Throws: If a error occurs accessing the named tag.
     func resolveRevision(tag: String) throws -> Revision
 
+    /// Resolve the revisions of all tags at once.
+    ///
+    /// This is equivalent to calling `resolveRevision(tag:)` for every tag
+    /// returned by `getTags()`, which implementations may do more efficiently.
+    func resolveTagRevisions() throws -> [String: Revision]
+
     /// Resolve the revision for an identifier.
     ///
     /// The identifier can be a branch name or a revision identifier.
@@ -231,6 +237,14 @@ public protocol Repository {
 }
 
 extension Repository {
+    public func resolveTagRevisions() throws -> [String: Revision] {
+        var revisions = [String: Revision]()
+        for tag in try self.getTags() {
+            revisions[tag] = try self.resolveRevision(tag: tag)
+        }
+        return revisions
+    }
+
     public func fetch(progress: FetchProgress.Handler?) throws {
         try fetch()
     }
@@ -355,6 +355,9 @@ public class RepositoryManager: Cancellable {
                         // Copy the repository from the cache into the repository path.
                         try self.fileSystem.createDirectory(repositoryPath.parentDirectory, recursive: true)
                         try self.provider.copy(from: cachedRepositoryPath, to: repositoryPath)
+                        // Keep track of the use so that garbage collection evicts the least recently used repositories.
+                        try? CacheAccessRecord(cacheDirectory: cachePath, fileSystem: self.fileSystem)
+                            .recordAccess(to: handle.repository.storagePath())
                     }
                 }
             } catch {
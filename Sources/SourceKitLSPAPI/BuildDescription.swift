@@ -20,6 +20,7 @@ private import SPMBuildCore
 // FIXME: should import these module with `private` or `internal` access control
 import class Build.BuildPlan
 import class Build.ClangModuleBuildDescription
+import enum Build.ModuleBuildDescription
 import class Build.SwiftModuleBuildDescription
 import struct PackageGraph.ResolvedModule
 import struct PackageGraph.ModulesGraph
@@ -103,14 +104,37 @@ private struct WrappedSwiftTargetBuildDescription: BuildTarget {
 public struct BuildDescription {
     private let buildPlan: Build.BuildPlan
 
-    /// The inputs of the build plan so we don't need to re-compute them  on every call to
+    /// The files among the inputs of the build plan, so we don't need to re-compute them on every call to
     /// `fileAffectsSwiftOrClangBuildSettings`.
-    private let inputs: [BuildPlan.Input]
+    private let inputFiles: Set<AbsolutePath>
+
+    /// The directories among the inputs of the build plan, any file inside of which affects the build plan.
+    private let inputDirectories: Set<AbsolutePath>
+
+    /// The build descriptions of the modules, keyed by the root directory of their sources.
+    private let modulesBySourcesRoot: [AbsolutePath: [ModuleBuildDescription]]
 
     // FIXME: should not use `BuildPlan` in the public interface
     public init(buildPlan: Build.BuildPlan) {
         self.buildPlan = buildPlan
-        self.inputs = buildPlan.inputs
+
+        var inputFiles = Set<AbsolutePath>()
+        var inputDirectories = Set<AbsolutePath>()
+        for input in buildPlan.inputs {
+            switch input {
+            case .directoryStructure(let path):
+                inputDirectories.insert(path)
+            case .file(let path):
+                inputFiles.insert(path)
+            }
+        }
+        self.inputFiles = inputFiles
+        self.inputDirectories = inputDirectories
+
+        self.modulesBySourcesRoot = Dictionary(
+            grouping: buildPlan.targetMap.values,
+            by: { $0.target.sources.root }
+        )
     }
 
     // FIXME: should not use `ResolvedTarget` in the public interface
@@ -155,18 +179,60 @@ public struct BuildDescription {
             return false
         }
 
-        for input in self.inputs {
-            switch input {
-            case .directoryStructure(let path):
-                if path.isAncestor(of: filePath) {
-                    return true
+        if self.inputFiles.contains(filePath) {
+            return true
+        }
+        return filePath.ancestors.contains { self.inputDirectories.contains($0) }
+    }
+
+    /// Adds and removes source files in the build descriptions of the modules containing them, without reloading the
+    /// package graph or replanning the build. A file belongs to the module with the innermost sources directory
+    /// containing it.
+    ///
+    /// Files that don't belong to any module, or that are in a language their module can't compile, are ignored.
+    /// Changes to the manifest, such as excluded paths, are not taken into account and require a new build
+    /// description. Updates must not happen concurrently with other uses of the build description.
+    ///
+    /// - Parameters:
+    ///   - addedFiles: The source files that were created.
+    ///   - removedFiles: The source files that were deleted.
+    /// - Returns: The targets whose sources changed.
+    @discardableResult
+    public func updateSourceFiles(added addedFiles: [URL], removed removedFiles: [URL]) -> [BuildTarget] {
+        var changes: [AbsolutePath: (added: [AbsolutePath], removed: [AbsolutePath])] = [:]
+        for (urls, isAdded) in [(addedFiles, true), (removedFiles, false)] {
+            for url in urls {
+                guard let filePath = try? AbsolutePath(validating: url.path),
+                      let root = filePath.ancestors.first(where: { self.modulesBySourcesRoot[$0] != nil })
+                else {
+                    continue
                 }
-            case .file(let path):
-                if filePath == path {
-                    return true
+                if isAdded {
+                    changes[root, default: ([], [])].added.append(filePath)
+                } else {
+                    changes[root, default: ([], [])].removed.append(filePath)
                 }
             }
         }
-        return false
+
+        var updatedTargets: [BuildTarget] = []
+        for (root, change) in changes {
+            for description in self.modulesBySourcesRoot[root] ?? [] {
+                guard description.updateSources(adding: change.added, removing: change.removed),
+                      let target = self.getBuildTarget(for: description.target, in: self.buildPlan.graph)
+                else {
+                    continue
+                }
+                updatedTargets.append(target)
+            }
+        }
+        return updatedTargets
+    }
+}
+
+extension AbsolutePath {
+    /// The ancestors of the path, innermost first.
+    fileprivate var ancestors: some Sequence<AbsolutePath> {
+        sequence(first: self) { $0.isRoot ? nil : $0.parentDirectory }.dropFirst()
     }
 }
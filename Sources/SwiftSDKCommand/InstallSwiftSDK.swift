@@ -34,6 +34,9 @@ public struct InstallSwiftSDK: SwiftSDKSubcommand {
     @Argument(help: "A local filesystem path or a URL of a Swift SDK bundle to install.")
     var bundlePathOrURL: String
 
+    @Option(help: "The expected SHA-256 checksum of the Swift SDK bundle archive.")
+    var checksum: String?
+
     public init() {}
 
     func run(
@@ -55,6 +58,7 @@ public struct InstallSwiftSDK: SwiftSDKSubcommand {
         )
         try await store.install(
             bundlePathOrURL: bundlePathOrURL,
+            checksum: self.checksum,
             UniversalArchiver(self.fileSystem, cancellator),
             HTTPClient()
         )
@@ -62,15 +62,18 @@ internal final class SourceControlPackageContainer: PackageContainer, CustomStri
     private let currentToolsVersion: ToolsVersion
     private let fingerprintStorage: PackageFingerprintStorage?
     private let fingerprintCheckingMode: FingerprintCheckingMode
+    private let resolutionMemo: ResolutionMemo?
     private let observabilityScope: ObservabilityScope
 
     /// The cached dependency information.
-    private var dependenciesCache = [String: [ProductFilter: (Manifest, [Constraint])]]()
+    private var dependenciesCache = [String: [ProductFilter: [Constraint]]]()
     private var dependenciesCacheLock = NSLock()
 
     private var knownVersionsCache = ThreadSafeBox<[Version: String]>()
     private var manifestsCache = ThreadSafeKeyValueStore<String, Manifest>()
     private var toolsVersionsCache = ThreadSafeKeyValueStore<Version, ToolsVersion>()
+    private var tagRevisionsCache = ThreadSafeBox<[String: Revision]>()
+    private var memoizedToolsVersionsCache = ThreadSafeBox<[Version: ToolsVersion]>()
 
     /// This is used to remember if tools version of a particular version is
     /// valid or not.
@@ -86,6 +89,7 @@ internal final class SourceControlPackageContainer: PackageContainer, CustomStri
         currentToolsVersion: ToolsVersion,
         fingerprintStorage: PackageFingerprintStorage?,
         fingerprintCheckingMode: FingerprintCheckingMode,
+        resolutionMemo: ResolutionMemo? = nil,
         observabilityScope: ObservabilityScope
     ) throws {
         self.package = package
@@ -97,6 +101,7 @@ internal final class SourceControlPackageContainer: PackageContainer, CustomStri
         self.currentToolsVersion = currentToolsVersion
         self.fingerprintStorage = fingerprintStorage
         self.fingerprintCheckingMode = fingerprintCheckingMode
+        self.resolutionMemo = resolutionMemo
         self.observabilityScope = observabilityScope.makeChildScope(
             description: "SourceControlPackageContainer",
             metadata: package.diagnosticsMetadata)
@@ -241,21 +246,94 @@ internal final class SourceControlPackageContainer: PackageContainer, CustomStri
             guard let tag = try self.knownVersions()[version] else {
                 throw StringError("unknown tag \(version)")
             }
-            let fileSystem = try repository.openFileView(tag: tag)
-            // find the manifest path and parse it's tools-version
-            let manifestPath = try ManifestLoader.findManifest(packagePath: .root, fileSystem: fileSystem, currentToolsVersion: self.currentToolsVersion)
-            return try ToolsVersionParser.parse(manifestPath: manifestPath, fileSystem: fileSystem)
+            guard let resolutionMemo = self.resolutionMemo else {
+                return try self.parseToolsVersion(tag: tag)
+            }
+            if let toolsVersion = try self.memoizedToolsVersions()[version] {
+                return toolsVersion
+            }
+            let toolsVersion = try self.parseToolsVersion(tag: tag)
+            resolutionMemo.setToolsVersion(
+                toolsVersion,
+                of: self.package,
+                at: try self.revision(forTag: tag),
+                observabilityScope: self.observabilityScope
+            )
+            return toolsVersion
         }
     }
 
+    /// The tools versions of all known versions that are in the resolution
+    /// memo.
+    ///
+    /// They are read all at once the first time the tools version of any
+    /// version is needed, so that the resolver can rule out versions with
+    /// incompatible tools versions without opening any of them.
+    private func memoizedToolsVersions() throws -> [Version: ToolsVersion] {
+        try self.memoizedToolsVersionsCache.memoize {
+            guard let resolutionMemo = self.resolutionMemo else {
+                return [:]
+            }
+            let knownVersions = try self.knownVersions()
+            let tagRevisions = try self.tagRevisions()
+            let toolsVersions = resolutionMemo.toolsVersions(
+                of: self.package,
+                at: knownVersions.values.compactMap { tagRevisions[$0] },
+                observabilityScope: self.observabilityScope
+            )
+            return knownVersions.compactMapValues { tag in tagRevisions[tag].flatMap { toolsVersions[$0] } }
+        }
+    }
+
+    /// The revisions of all tags, resolved at once since every version the
+    /// resolver looks at needs one to consult the resolution memo.
+    private func tagRevisions() throws -> [String: Revision] {
+        try self.tagRevisionsCache.memoize {
+            try self.repository.resolveTagRevisions()
+        }
+    }
+
+    private func revision(forTag tag: String) throws -> Revision {
+        try self.tagRevisions()[tag] ?? self.repository.resolveRevision(tag: tag)
+    }
+
+    private func parseToolsVersion(tag: String) throws -> ToolsVersion {
+        let fileSystem = try repository.openFileView(tag: tag)
+        // find the manifest path and parse it's tools-version
+        let manifestPath = try ManifestLoader.findManifest(packagePath: .root, fileSystem: fileSystem, currentToolsVersion: self.currentToolsVersion)
+        return try ToolsVersionParser.parse(manifestPath: manifestPath, fileSystem: fileSystem)
+    }
+
     public func getDependencies(at version: Version, productFilter: ProductFilter) throws -> [Constraint] {
         do {
             return try self.getCachedDependencies(forIdentifier: version.description, productFilter: productFilter) {
                 guard let tag = try self.knownVersions()[version] else {
                     throw StringError("unknown tag \(version)")
                 }
-                return try self.loadDependencies(tag: tag, version: version, productFilter: productFilter)
-            }.1
+                // Releases are immutable, so their dependencies can be taken
+                // from the memo, keyed by the revision the tag points to.
+                guard let resolutionMemo = self.resolutionMemo else {
+                    return try self.loadDependencies(tag: tag, version: version, productFilter: productFilter)
+                }
+                let revision = try self.revision(forTag: tag)
+                if let dependencies = resolutionMemo.dependencies(
+                    of: self.package,
+                    at: revision,
+                    productFilter: productFilter,
+                    observabilityScope: self.observabilityScope
+                ) {
+                    return dependencies
+                }
+                let dependencies = try self.loadDependencies(tag: tag, version: version, productFilter: productFilter)
+                resolutionMemo.setDependencies(
+                    dependencies,
+                    of: self.package,
+                    at: revision,
+                    productFilter: productFilter,
+                    observabilityScope: self.observabilityScope
+                )
+                return dependencies
+            }
         } catch {
             throw GetDependenciesError(
                 repository: self.repositorySpecifier,
@@ -272,7 +350,7 @@ internal final class SourceControlPackageContainer: PackageContainer, CustomStri
                 // resolve the revision identifier and return its dependencies.
                 let revision = try repository.resolveRevision(identifier: revision)
                 return try self.loadDependencies(at: revision, productFilter: productFilter)
-            }.1
+            }
         } catch {
             // Examine the error to see if we can come up with a more informative and actionable error message.  We know that the revision is expected to be a branch name or a hash (tags are handled through a different code path).
             if let error = error as? GitRepositoryError, error.description.contains("Needed a single revision") {
@@ -313,8 +391,8 @@ internal final class SourceControlPackageContainer: PackageContainer, CustomStri
     private func getCachedDependencies(
         forIdentifier identifier: String,
         productFilter: ProductFilter,
-        getDependencies: () throws -> (Manifest, [Constraint])
-    ) throws -> (Manifest, [Constraint]) {
+        getDependencies: () throws -> [Constraint]
+    ) throws -> [Constraint] {
         if let result = (self.dependenciesCacheLock.withLock { self.dependenciesCache[identifier, default: [:]][productFilter] }) {
             return result
         }
@@ -330,9 +408,9 @@ internal final class SourceControlPackageContainer: PackageContainer, CustomStri
         tag: String,
         version: Version? = nil,
         productFilter: ProductFilter
-    ) throws -> (Manifest, [Constraint]) {
+    ) throws -> [Constraint] {
         let manifest = try self.loadManifest(tag: tag, version: version)
-        return (manifest, try manifest.dependencyConstraints(productFilter: productFilter))
+        return try manifest.dependencyConstraints(productFilter: productFilter)
     }
 
     /// Returns dependencies of a container at the given revision.
@@ -340,9 +418,9 @@ internal final class SourceControlPackageContainer: PackageContainer, CustomStri
         at revision: Revision,
         version: Version? = nil,
         productFilter: ProductFilter
-    ) throws -> (Manifest, [Constraint]) {
+    ) throws -> [Constraint] {
         let manifest = try self.loadManifest(at: revision, version: version)
-        return (manifest, try manifest.dependencyConstraints(productFilter: productFilter))
+        return try manifest.dependencyConstraints(productFilter: productFilter)
     }
 
     public func getUnversionedDependencies(productFilter: ProductFilter) throws -> [Constraint] {
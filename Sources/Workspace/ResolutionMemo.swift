@@ -0,0 +1,313 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import Basics
+import PackageGraph
+import PackageModel
+import SourceControl
+
+import class TSCBasic.BufferedOutputByteStream
+import struct TSCBasic.CodableRange
+
+import struct TSCUtility.Version
+
+/// Machine-wide memo of the tools versions and dependency constraints of
+/// source control package releases, shared by all workspaces of the user.
+///
+/// Entries are keyed by the revision a release's tag points to, which
+/// identifies the contents of all of its manifests, so they never go stale: a
+/// moved tag points to a revision that isn't memoized yet. The keys also
+/// include everything else the evaluation of a manifest depends on, that is
+/// the package location, the current tools version, the version of SwiftPM,
+/// the environment and the mirrors, so differently configured workspaces
+/// don't share entries.
+final class ResolutionMemo {
+    fileprivate struct Entry: Codable {
+        var toolsVersion: ToolsVersion?
+        var dependencies: [Constraint]?
+    }
+
+    fileprivate struct Constraint: Codable {
+        enum Kind: String, Codable {
+            case root
+            case fileSystem
+            case localSourceControl
+            case remoteSourceControl
+            case registry
+        }
+
+        enum Requirement: Codable {
+            case any
+            case empty
+            case range(CodableRange<Version>)
+            case exact(Version)
+            case ranges([CodableRange<Version>])
+            case revision(String)
+            case unversioned
+        }
+
+        var identity: String
+        var kind: Kind
+        var location: String
+        var name: String
+        var requirement: Requirement
+        var products: ProductFilter
+    }
+
+    /// The path of the database.
+    let path: AbsolutePath
+
+    private let currentToolsVersion: ToolsVersion
+    private let mirrors: DependencyMirrors
+
+    /// The database, which is opened on first use and stays open until the memo is closed.
+    private let cache: SQLiteBackedCache<Entry>
+
+    init(path: AbsolutePath, currentToolsVersion: ToolsVersion, mirrors: DependencyMirrors) {
+        self.path = path
+        self.currentToolsVersion = currentToolsVersion
+        self.mirrors = mirrors
+
+        var configuration = SQLiteBackedCacheConfiguration()
+        configuration.maxSizeInMegabytes = 100
+        configuration.truncateWhenFull = true
+        self.cache = SQLiteBackedCache<Entry>(
+            tableName: "RESOLUTION_MEMO",
+            path: path,
+            configuration: configuration
+        )
+    }
+
+    deinit {
+        try? self.close()
+    }
+
+    /// Closes the database. It is reopened if the memo is used again.
+    func close() throws {
+        try self.cache.close()
+    }
+
+    /// Returns the memoized tools version of `package` at `revision`.
+    func toolsVersion(
+        of package: PackageReference,
+        at revision: Revision,
+        observabilityScope: ObservabilityScope
+    ) -> ToolsVersion? {
+        self.get(
+            key: self.key(package: package, revision: revision, productFilter: nil),
+            observabilityScope: observabilityScope
+        )?.toolsVersion
+    }
+
+    /// Returns the memoized tools versions of `package` at any of
+    /// `revisions`.
+    func toolsVersions(
+        of package: PackageReference,
+        at revisions: [Revision],
+        observabilityScope: ObservabilityScope
+    ) -> [Revision: ToolsVersion] {
+        do {
+            var toolsVersions = [Revision: ToolsVersion]()
+            for revision in revisions {
+                let key = self.key(package: package, revision: revision, productFilter: nil)
+                toolsVersions[revision] = try self.cache.get(key: key)?.toolsVersion
+            }
+            return toolsVersions
+        } catch {
+            observabilityScope.emit(debug: "failed reading the resolution memo", underlyingError: error)
+            return [:]
+        }
+    }
+
+    /// Memoizes the tools version of `package` at `revision`.
+    func setToolsVersion(
+        _ toolsVersion: ToolsVersion,
+        of package: PackageReference,
+        at revision: Revision,
+        observabilityScope: ObservabilityScope
+    ) {
+        self.put(
+            Entry(toolsVersion: toolsVersion),
+            key: self.key(package: package, revision: revision, productFilter: nil),
+            observabilityScope: observabilityScope
+        )
+    }
+
+    /// Returns the memoized dependency constraints of the products of
+    /// `package` selected by `productFilter` at `revision`.
+    func dependencies(
+        of package: PackageReference,
+        at revision: Revision,
+        productFilter: ProductFilter,
+        observabilityScope: ObservabilityScope
+    ) -> [PackageContainerConstraint]? {
+        guard let constraints = self.get(
+            key: self.key(package: package, revision: revision, productFilter: productFilter),
+            observabilityScope: observabilityScope
+        )?.dependencies else {
+            return nil
+        }
+        do {
+            return try constraints.map { try PackageContainerConstraint($0) }
+        } catch {
+            observabilityScope.emit(debug: "ignoring invalid resolution memo entry", underlyingError: error)
+            return nil
+        }
+    }
+
+    /// Memoizes the dependency constraints of the products of `package`
+    /// selected by `productFilter` at `revision`.
+    func setDependencies(
+        _ dependencies: [PackageContainerConstraint],
+        of package: PackageReference,
+        at revision: Revision,
+        productFilter: ProductFilter,
+        observabilityScope: ObservabilityScope
+    ) {
+        self.put(
+            Entry(dependencies: dependencies.map(Constraint.init)),
+            key: self.key(package: package, revision: revision, productFilter: productFilter),
+            observabilityScope: observabilityScope
+        )
+    }
+
+    private func key(package: PackageReference, revision: Revision, productFilter: ProductFilter?) -> String {
+        let stream = BufferedOutputByteStream()
+        stream.send(package.identity.description)
+        stream.send(package.locationString)
+        stream.send(revision.identifier)
+        switch productFilter {
+        case .none:
+            stream.send("tools-version")
+        case .some(.everything):
+            stream.send("everything")
+        case .some(.specific(let products)):
+            stream.send("specific")
+            for product in products.sorted() {
+                stream.send(product)
+            }
+        }
+        stream.send(self.currentToolsVersion.description)
+        stream.send(SwiftVersion.current.displayString)
+        for (key, value) in Environment.current.cachable.sorted(by: { $0.key > $1.key }) {
+            stream.send(key.rawValue).send(value)
+        }
+        for (original, mirror) in self.mirrors.mapping.sorted(by: { $0.key < $1.key }) {
+            stream.send(original).send(mirror)
+        }
+        return stream.bytes.sha256Checksum
+    }
+
+    // The memo is only an optimization, so failing to read or write it isn't
+    // an error.
+
+    private func get(key: String, observabilityScope: ObservabilityScope) -> Entry? {
+        do {
+            return try self.cache.get(key: key)
+        } catch {
+            observabilityScope.emit(debug: "failed reading the resolution memo", underlyingError: error)
+            return nil
+        }
+    }
+
+    private func put(_ entry: Entry, key: String, observabilityScope: ObservabilityScope) {
+        do {
+            try self.cache.put(key: key, value: entry, replace: true)
+        } catch {
+            observabilityScope.emit(debug: "failed writing the resolution memo", underlyingError: error)
+        }
+    }
+}
+
+extension ResolutionMemo.Constraint {
+    fileprivate init(_ constraint: PackageContainerConstraint) {
+        self.identity = constraint.package.identity.description
+        switch constraint.package.kind {
+        case .root(let path):
+            self.kind = .root
+            self.location = path.pathString
+        case .fileSystem(let path):
+            self.kind = .fileSystem
+            self.location = path.pathString
+        case .localSourceControl(let path):
+            self.kind = .localSourceControl
+            self.location = path.pathString
+        case .remoteSourceControl(let url):
+            self.kind = .remoteSourceControl
+            self.location = url.absoluteString
+        case .registry(let identity):
+            self.kind = .registry
+            self.location = identity.description
+        }
+        self.name = constraint.package.deprecatedName
+
+        switch constraint.requirement {
+        case .versionSet(.any):
+            self.requirement = .any
+        case .versionSet(.empty):
+            self.requirement = .empty
+        case .versionSet(.range(let range)):
+            self.requirement = .range(CodableRange(range))
+        case .versionSet(.exact(let version)):
+            self.requirement = .exact(version)
+        case .versionSet(.ranges(let ranges)):
+            self.requirement = .ranges(ranges.map { CodableRange($0) })
+        case .revision(let revision):
+            self.requirement = .revision(revision)
+        case .unversioned:
+            self.requirement = .unversioned
+        }
+        self.products = constraint.products
+    }
+}
+
+extension PackageContainerConstraint {
+    fileprivate init(_ constraint: ResolutionMemo.Constraint) throws {
+        let kind: PackageReference.Kind
+        switch constraint.kind {
+        case .root:
+            kind = try .root(AbsolutePath(validating: constraint.location))
+        case .fileSystem:
+            kind = try .fileSystem(AbsolutePath(validating: constraint.location))
+        case .localSourceControl:
+            kind = try .localSourceControl(AbsolutePath(validating: constraint.location))
+        case .remoteSourceControl:
+            kind = .remoteSourceControl(SourceControlURL(constraint.location))
+        case .registry:
+            kind = .registry(.plain(constraint.location))
+        }
+
+        let requirement: PackageRequirement
+        switch constraint.requirement {
+        case .any:
+            requirement = .versionSet(.any)
+        case .empty:
+            requirement = .versionSet(.empty)
+        case .range(let range):
+            requirement = .versionSet(.range(range.range))
+        case .exact(let version):
+            requirement = .versionSet(.exact(version))
+        case .ranges(let ranges):
+            requirement = .versionSet(.ranges(ranges.map(\.range)))
+        case .revision(let revision):
+            requirement = .revision(revision)
+        case .unversioned:
+            requirement = .unversioned
+        }
+
+        self.init(
+            package: PackageReference(identity: .plain(constraint.identity), kind: kind, name: constraint.name),
+            requirement: requirement,
+            products: constraint.products
+        )
+    }
+}
@@ -597,39 +597,47 @@ extension Workspace {
             let cacheKey = artifact.url.absoluteString.spm_mangledToC99ExtendedIdentifier()
             let cachedArtifactPath = cachePath.appending(cacheKey)
 
-            if self.fileSystem.exists(cachedArtifactPath) {
-                observabilityScope.emit(debug: "copying cached binary artifact for \(artifact.url) from \(cachedArtifactPath)")
-                self.delegate?.willDownloadBinaryArtifact(from: artifact.url.absoluteString, fromCache: true)
-                return completion(
-                    Result.init(catching: {
+            // The cached artifact is locked while it is downloaded or copied, so that it isn't evicted by the garbage
+            // collection of the shared caches meanwhile. The download is awaited while holding the lock, so this
+            // happens off the calling thread.
+            DispatchQueue.sharedConcurrent.async {
+                let result = Result<Bool, Error> {
+                    try self.fileSystem.withLock(on: cachedArtifactPath, type: .exclusive) {
+                        if self.fileSystem.exists(cachedArtifactPath) {
+                            observabilityScope.emit(debug: "copying cached binary artifact for \(artifact.url) from \(cachedArtifactPath)")
+                            self.delegate?.willDownloadBinaryArtifact(from: artifact.url.absoluteString, fromCache: true)
+                            // copy from cache to destination
+                            try self.fileSystem.copy(from: cachedArtifactPath, to: destination)
+                            try? CacheAccessRecord(cacheDirectory: cachePath, fileSystem: self.fileSystem)
+                                .recordAccess(to: RelativePath(validating: cacheKey))
+                            return true // fetched from cache
+                        }
+
+                        // download to the cache
+                        observabilityScope.emit(debug: "downloading binary artifact for \(artifact.url) to cached at \(cachedArtifactPath)")
+                        let downloadResult = Result<Void, Error> {
+                            try temp_await {
+                                self.download(
+                                    artifact: artifact,
+                                    destination: cachedArtifactPath,
+                                    observabilityScope: observabilityScope,
+                                    progress: progress,
+                                    completion: $0
+                                )
+                            }
+                        }
+                        self.delegate?.willDownloadBinaryArtifact(from: artifact.url.absoluteString, fromCache: false)
+                        if case .failure = downloadResult {
+                            try? self.fileSystem.removeFileTree(cachedArtifactPath)
+                        }
+                        try downloadResult.get()
                         // copy from cache to destination
                         try self.fileSystem.copy(from: cachedArtifactPath, to: destination)
-                        return true // fetched from cache
-                    })
-                )
-            }
-
-            // download to the cache
-            observabilityScope.emit(debug: "downloading binary artifact for \(artifact.url) to cached at \(cachedArtifactPath)")
-            self.download(
-                artifact: artifact,
-                destination: cachedArtifactPath,
-                observabilityScope: observabilityScope,
-                progress: progress,
-                completion: { result in
-                    self.delegate?.willDownloadBinaryArtifact(from: artifact.url.absoluteString, fromCache: false)
-                    if case .failure = result {
-                        try? self.fileSystem.removeFileTree(cachedArtifactPath)
+                        return false // not fetched from cache
                     }
-                    completion(result.flatMap {
-                        Result.init(catching: {
-                            // copy from cache to destination
-                            try self.fileSystem.copy(from: cachedArtifactPath, to: destination)
-                            return false // not fetched from cache
-                        })
-                    })
                 }
-            )
+                completion(result)
+            }
         }
 
         private func download(
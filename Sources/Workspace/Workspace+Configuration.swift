@@ -149,6 +149,11 @@ extension Workspace {
             self.sharedCacheDirectory.map { $0.appending("artifacts") }
         }
 
+        /// Path to the shared resolution memo.
+        public var sharedResolutionMemoFile: AbsolutePath? {
+            self.sharedCacheDirectory.map { $0.appending(components: "resolution", "memo.db") }
+        }
+
         /// Create a new workspace location.
         ///
         /// - Parameters:
@@ -776,6 +781,9 @@ public struct WorkspaceConfiguration {
     /// Whether to create a product for use in the Swift REPL
     public var createREPLProduct: Bool
 
+    /// Whether to link automatic library products as shared libraries where that is safe
+    public var preferDynamicLibraries: Bool
+
     /// Whether or not there should be import restrictions applied when loading manifests
     public var manifestImportRestrictions: (startingToolsVersion: ToolsVersion, allowedImports: [String])?
 
@@ -784,6 +792,7 @@ public struct WorkspaceConfiguration {
         prefetchBasedOnResolvedFile: Bool,
         shouldCreateMultipleTestProducts: Bool,
         createREPLProduct: Bool,
+        preferDynamicLibraries: Bool = false,
         additionalFileRules: [FileRuleDescription],
         sharedDependenciesCacheEnabled: Bool,
         fingerprintCheckingMode: CheckingMode,
@@ -797,6 +806,7 @@ public struct WorkspaceConfiguration {
         self.prefetchBasedOnResolvedFile = prefetchBasedOnResolvedFile
         self.shouldCreateMultipleTestProducts = shouldCreateMultipleTestProducts
         self.createREPLProduct = createREPLProduct
+        self.preferDynamicLibraries = preferDynamicLibraries
         self.additionalFileRules = additionalFileRules
         self.sharedDependenciesCacheEnabled = sharedDependenciesCacheEnabled
         self.fingerprintCheckingMode = fingerprintCheckingMode
@@ -814,6 +824,7 @@ public struct WorkspaceConfiguration {
             prefetchBasedOnResolvedFile: true,
             shouldCreateMultipleTestProducts: false,
             createREPLProduct: false,
+            preferDynamicLibraries: false,
             additionalFileRules: [],
             sharedDependenciesCacheEnabled: true,
             fingerprintCheckingMode: .strict,
@@ -0,0 +1,334 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import struct Basics.AbsolutePath
+import struct Basics.CacheAccessRecord
+import protocol Basics.FileSystem
+import class Basics.ObservabilityScope
+import struct Basics.RelativePath
+import struct Foundation.Date
+import class PackageLoading.ManifestLoader
+import enum PackageModel.BuildConfiguration
+import class TSCBasic.FileLock
+
+extension Workspace {
+    /// The size limits to enforce when collecting garbage.
+    public struct GarbageCollectionLimits: Equatable {
+        /// The maximum number of bytes the build directories in the scratch directory may occupy.
+        public var scratchDirectorySize: UInt64?
+
+        /// The maximum number of bytes the shared caches may occupy.
+        public var sharedCacheSize: UInt64?
+
+        public init(scratchDirectorySize: UInt64? = nil, sharedCacheSize: UInt64? = nil) {
+            self.scratchDirectorySize = scratchDirectorySize
+            self.sharedCacheSize = sharedCacheSize
+        }
+    }
+
+    /// The outcome of a garbage collection.
+    public struct GarbageCollectionResult {
+        /// The paths that were removed, least recently used first.
+        public var removedPaths: [AbsolutePath] = []
+
+        /// The number of bytes reclaimed.
+        public var reclaimedBytes: UInt64 = 0
+    }
+
+    /// Evicts the least recently used build directories and shared cache entries until the scratch directory and the
+    /// shared caches fit within the given limits.
+    ///
+    /// Build directories are evicted per triple and configuration, and their intermediate module caches can be
+    /// evicted on their own. Other contents of the scratch directory are left alone. The scratch directory as a whole
+    /// is guarded by the workspace lock, which callers are expected to hold. Shared cache entries are evicted under
+    /// the same locks their owners take to use them. Entries that are in use, either because they are listed in
+    /// `protectedPaths` or because another SwiftPM process holds one of their locks, are skipped.
+    ///
+    /// - Parameters:
+    ///     - limits: The size limits to enforce.
+    ///     - protectedPaths: Paths that must not be evicted, such as the build directories of the current build.
+    ///     - observabilityScope: The observability scope that reports errors, warnings, etc
+    @discardableResult
+    public func collectGarbage(
+        limits: GarbageCollectionLimits,
+        protectedPaths: [AbsolutePath] = [],
+        observabilityScope: ObservabilityScope
+    ) -> GarbageCollectionResult {
+        var result = GarbageCollectionResult()
+
+        if let limit = limits.scratchDirectorySize {
+            let entries = observabilityScope.trap {
+                try self.scratchDirectoryGarbageCollectionEntries()
+            } ?? []
+            self.evict(
+                entries,
+                downTo: limit,
+                protectedPaths: protectedPaths,
+                result: &result,
+                observabilityScope: observabilityScope
+            )
+        }
+
+        if let limit = limits.sharedCacheSize {
+            let entries = observabilityScope.trap {
+                try self.sharedCacheGarbageCollectionEntries()
+            } ?? []
+            self.evict(
+                entries,
+                downTo: limit,
+                protectedPaths: protectedPaths,
+                result: &result,
+                observabilityScope: observabilityScope
+            )
+        }
+
+        return result
+    }
+
+    /// Returns the evictable build directories of the scratch directory.
+    private func scratchDirectoryGarbageCollectionEntries() throws -> [GarbageCollectionEntry] {
+        let scratchDirectory = self.location.scratchDirectory
+        guard self.fileSystem.isDirectory(scratchDirectory) else {
+            return []
+        }
+
+        // These hold the state of the workspace rather than build results.
+        let protectedAssets: Set<AbsolutePath> = [
+            self.repositoryManager.path,
+            self.location.repositoriesCheckoutsDirectory,
+            self.location.registryDownloadDirectory.parentDirectory,
+            self.location.artifactsDirectory,
+            self.state.storagePath,
+        ]
+        let configurationNames = Set(BuildConfiguration.allCases.map(\.rawValue))
+
+        var entries = [GarbageCollectionEntry]()
+        for name in try self.fileSystem.getDirectoryContents(scratchDirectory) where !name.hasPrefix(".") {
+            let path = scratchDirectory.appending(component: name)
+            guard !protectedAssets.contains(path),
+                  !self.fileSystem.isSymlink(path),
+                  self.fileSystem.isDirectory(path)
+            else {
+                continue
+            }
+
+            // Only triple directories hold build results, evict each of their configurations on its own.
+            let configurations = try self.fileSystem.getDirectoryContents(path)
+                .filter { configurationNames.contains($0) }
+                .map { path.appending(component: $0) }
+                .filter { !self.fileSystem.isSymlink($0) && self.fileSystem.isDirectory($0) }
+            for configuration in configurations {
+                let moduleCache = configuration.appending(component: "ModuleCache")
+                if self.fileSystem.isDirectory(moduleCache) {
+                    try entries.append(self.garbageCollectionEntry(at: moduleCache))
+                }
+                try entries.append(self.garbageCollectionEntry(at: configuration, excluding: ["ModuleCache"]))
+            }
+        }
+        return entries
+    }
+
+    /// Returns the evictable entries of the shared caches.
+    private func sharedCacheGarbageCollectionEntries() throws -> [GarbageCollectionEntry] {
+        var entries = [GarbageCollectionEntry]()
+
+        // `RepositoryManager` fetches into a cached repository while holding a shared lock on the cache and an
+        // exclusive lock on the repository, and purges the cache while holding an exclusive lock on it.
+        if let cacheDirectory = self.location.sharedRepositoriesCacheDirectory,
+           self.fileSystem.isDirectory(cacheDirectory)
+        {
+            entries += try self.cacheGarbageCollectionEntries(in: cacheDirectory, depth: 1) { path in
+                [(cacheDirectory, .shared), (path, .exclusive)]
+            }
+        }
+
+        // Binary artifacts are cached as archive files, which `BinaryArtifactsManager` locks while it downloads them
+        // into the cache or copies them out of it.
+        if let cacheDirectory = self.location.sharedBinaryArtifactsCacheDirectory,
+           self.fileSystem.isDirectory(cacheDirectory)
+        {
+            entries += try self.cacheGarbageCollectionEntries(in: cacheDirectory, depth: 1) { path in
+                [(path, .exclusive)]
+            }
+        }
+
+        // Registry downloads are stored by scope, name and version, and locked by `RegistryDownloadsManager` while
+        // they are unpacked or copied.
+        if let cacheDirectory = self.location.sharedRegistryDownloadsCacheDirectory,
+           self.fileSystem.isDirectory(cacheDirectory)
+        {
+            entries += try self.cacheGarbageCollectionEntries(in: cacheDirectory, depth: 3) { path in
+                [(path, .exclusive)]
+            }
+        }
+
+        // The manifests cache is a single database, so it can only be evicted as a whole. Its connections take an
+        // exclusive lock on the database for every access and reopen it if it was removed in the meantime.
+        if let cacheDirectory = self.location.sharedManifestsCacheDirectory {
+            let databasePath = ManifestLoader.manifestCacheDBPath(cacheDirectory)
+            if self.fileSystem.isFile(databasePath) {
+                try entries.append(self.databaseGarbageCollectionEntry(at: databasePath))
+            }
+        }
+
+        return entries
+    }
+
+    /// Returns the files and directories found `depth` levels below `cacheDirectory`, using the access record of the
+    /// cache to order them.
+    private func cacheGarbageCollectionEntries(
+        in cacheDirectory: AbsolutePath,
+        depth: Int,
+        locks: (AbsolutePath) -> [GarbageCollectionEntry.Lock]
+    ) throws -> [GarbageCollectionEntry] {
+        let accessRecord = CacheAccessRecord(cacheDirectory: cacheDirectory, fileSystem: self.fileSystem)
+        let lastAccessDates = (try? accessRecord.lastAccessDates()) ?? [:]
+
+        var paths = [cacheDirectory]
+        for level in 1 ... depth {
+            paths = try paths.flatMap { directory in
+                try self.fileSystem.getDirectoryContents(directory)
+                    .filter { !$0.hasPrefix(".") }
+                    .map { directory.appending(component: $0) }
+                    .filter { level == depth || self.fileSystem.isDirectory($0) }
+            }
+        }
+
+        return try paths.map { path in
+            var entry = try self.garbageCollectionEntry(at: path)
+            let relativePath = path.relative(to: cacheDirectory)
+            if let lastAccess = lastAccessDates[relativePath], lastAccess > entry.lastAccess {
+                entry.lastAccess = lastAccess
+            }
+            entry.accessRecord = (accessRecord, relativePath)
+            entry.locks = locks(path)
+            return entry
+        }
+    }
+
+    /// Creates an entry for the SQLite database at `path`, along with its write-ahead log and shared memory files.
+    private func databaseGarbageCollectionEntry(at path: AbsolutePath) throws -> GarbageCollectionEntry {
+        let files = [path, path.parentDirectory.appending(component: path.basename + "-wal"),
+                     path.parentDirectory.appending(component: path.basename + "-shm")]
+        var size: UInt64 = 0
+        var lastAccess = Date.distantPast
+        for file in files where self.fileSystem.isFile(file) {
+            size += try self.fileSystem.fileTreeSize(file)
+            lastAccess = max(lastAccess, try self.fileSystem.getFileInfo(file).modTime)
+        }
+        var entry = GarbageCollectionEntry(path: path, size: size, lastAccess: lastAccess)
+        entry.files = files
+        entry.locks = [(path, .exclusive)]
+        return entry
+    }
+
+    /// Creates an entry for the file or file tree at `path`. Its last access is approximated by the most recent
+    /// modification of the file, or of the directory and its immediate children.
+    private func garbageCollectionEntry(
+        at path: AbsolutePath,
+        excluding excludedNames: Set<String> = []
+    ) throws -> GarbageCollectionEntry {
+        var lastAccess = try self.fileSystem.getFileInfo(path).modTime
+        guard self.fileSystem.isDirectory(path) else {
+            return try GarbageCollectionEntry(path: path, size: self.fileSystem.fileTreeSize(path), lastAccess: lastAccess)
+        }
+
+        var size: UInt64 = 0
+        for name in try self.fileSystem.getDirectoryContents(path) where !excludedNames.contains(name) {
+            let child = path.appending(component: name)
+            size += try self.fileSystem.fileTreeSize(child)
+            if !self.fileSystem.isSymlink(child) {
+                lastAccess = max(lastAccess, try self.fileSystem.getFileInfo(child).modTime)
+            }
+        }
+        return GarbageCollectionEntry(path: path, size: size, lastAccess: lastAccess)
+    }
+
+    private func evict(
+        _ entries: [GarbageCollectionEntry],
+        downTo limit: UInt64,
+        protectedPaths: [AbsolutePath],
+        result: inout GarbageCollectionResult,
+        observabilityScope: ObservabilityScope
+    ) {
+        var totalSize = entries.reduce(0) { $0 + $1.size }
+        var removedPaths = [AbsolutePath]()
+
+        for entry in entries.sorted(by: { $0.lastAccess < $1.lastAccess }) {
+            guard totalSize > limit else {
+                break
+            }
+            // Entries nested in an evicted entry are already gone.
+            guard !removedPaths.contains(where: { entry.path.isDescendantOfOrEqual(to: $0) }) else {
+                continue
+            }
+            guard !protectedPaths.contains(where: {
+                entry.path.isDescendantOfOrEqual(to: $0) || $0.isDescendant(of: entry.path)
+            }) else {
+                continue
+            }
+
+            do {
+                try self.withLocks(entry.locks[...]) {
+                    for file in entry.files ?? [entry.path] {
+                        try self.fileSystem.removeFileTree(file)
+                    }
+                }
+            } catch {
+                observabilityScope.emit(debug: "skipping eviction of '\(entry.path)'", underlyingError: error)
+                continue
+            }
+            if let (accessRecord, relativePath) = entry.accessRecord {
+                try? accessRecord.removeEntries([relativePath])
+            }
+
+            // Account for the entries nested in this one that haven't been evicted yet.
+            let nestedSize = entries
+                .filter { $0.path.isDescendant(of: entry.path) && !removedPaths.contains($0.path) }
+                .reduce(0) { $0 + $1.size }
+            let reclaimedBytes = entry.size + nestedSize
+            totalSize -= min(totalSize, reclaimedBytes)
+            removedPaths.append(entry.path)
+
+            result.removedPaths.append(entry.path)
+            result.reclaimedBytes += reclaimedBytes
+            observabilityScope.emit(debug: "evicted '\(entry.path)' (\(reclaimedBytes) bytes)")
+        }
+    }
+
+    /// Runs `body` while holding `locks`, taking them in order. Fails rather than waiting for a lock that another
+    /// process holds, so that entries in use are skipped.
+    private func withLocks(_ locks: ArraySlice<GarbageCollectionEntry.Lock>, _ body: () throws -> Void) throws {
+        guard let lock = locks.first else {
+            return try body()
+        }
+        try self.fileSystem.withLock(on: lock.path, type: lock.type, blocking: false) {
+            try self.withLocks(locks.dropFirst(), body)
+        }
+    }
+}
+
+/// A file tree that can be evicted by the garbage collector.
+private struct GarbageCollectionEntry {
+    typealias Lock = (path: AbsolutePath, type: FileLock.LockType)
+
+    var path: AbsolutePath
+    var size: UInt64
+    var lastAccess: Date
+    var accessRecord: (record: CacheAccessRecord, entry: RelativePath)?
+
+    /// The locks the owner of the entry takes to use it, outermost first.
+    var locks: [Lock] = []
+
+    /// The files to remove to evict the entry, if not the file tree at `path`.
+    var files: [AbsolutePath]?
+}
@@ -74,6 +74,7 @@ extension Workspace: PackageContainerProvider {
                             fingerprintStorage: self.fingerprints,
                             fingerprintCheckingMode: FingerprintCheckingMode
                                 .map(self.configuration.fingerprintCheckingMode),
+                            resolutionMemo: self.resolutionMemo,
                             observabilityScope: observabilityScope
                         )
                     }
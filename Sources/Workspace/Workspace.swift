@@ -134,6 +134,11 @@ public class Workspace {
     /// Binary artifacts manager used for downloading and extracting binary artifacts
     let binaryArtifactsManager: BinaryArtifactsManager
 
+    /// The memo of the tools versions and dependencies of package releases,
+    /// if the manifests are evaluated by a plain manifest loader whose results
+    /// only depend on what the memo keys include.
+    let resolutionMemo: ResolutionMemo?
+
     /// The package fingerprints storage
     let fingerprints: PackageFingerprintStorage?
 
@@ -454,6 +459,14 @@ public class Workspace {
 
         let configuration = configuration ?? .default
 
+        // Only the results of the default loading pipeline can be shared
+        // between workspaces.
+        let isDefaultManifestLoading = manifestLoader is ManifestLoader
+            && configuration.manifestImportRestrictions == nil
+            && configuration.sourceControlToRegistryDependencyTransformation == .disabled
+            && customIdentityResolver == nil
+            && customDependencyMapper == nil
+
         let mirrors = try customMirrors ?? Workspace.Configuration.Mirrors(
             fileSystem: fileSystem,
             localMirrorsFile: location.localMirrorsConfigurationFile,
@@ -550,6 +563,12 @@ public class Workspace {
         // register the binary artifacts downloader with the cancellation handler
         cancellator?.register(name: "binary artifacts downloads", handler: binaryArtifactsManager)
 
+        let resolutionMemo = isDefaultManifestLoading && configuration.sharedDependenciesCacheEnabled
+            ? location.sharedResolutionMemoFile.map {
+                ResolutionMemo(path: $0, currentToolsVersion: currentToolsVersion, mirrors: mirrors)
+            }
+            : nil
+
         // initialize
         self.fileSystem = fileSystem
         self.configuration = configuration
@@ -566,6 +585,7 @@ public class Workspace {
         self.registryClient = registryClient
         self.registryDownloadsManager = registryDownloadsManager
         self.binaryArtifactsManager = binaryArtifactsManager
+        self.resolutionMemo = resolutionMemo
 
         self.identityResolver = identityResolver
         self.dependencyMapper = dependencyMapper
@@ -954,6 +974,7 @@ extension Workspace {
             binaryArtifacts: binaryArtifacts,
             shouldCreateMultipleTestProducts: self.configuration.shouldCreateMultipleTestProducts,
             createREPLProduct: self.configuration.createREPLProduct,
+            preferDynamicLibraries: self.configuration.preferDynamicLibraries,
             traitConfiguration: traitConfiguration,
             customXCTestMinimumDeploymentTargets: customXCTestMinimumDeploymentTargets,
             testEntryPointPath: testEntryPointPath,
@@ -33,6 +33,7 @@ import var TSCBasic.stdoutStream
 import enum TSCUtility.Diagnostics
 import struct TSCUtility.Version
 
+Concurrency.captureJobServer()
 SwiftBootstrapBuildTool.main()
 
 struct SwiftBootstrapBuildTool: ParsableCommand {
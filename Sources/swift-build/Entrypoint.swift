@@ -10,11 +10,13 @@
 //
 //===----------------------------------------------------------------------===//
 
+import Basics
 import Commands
 
 @main
 struct Entrypoint {
     static func main() async {
+        Concurrency.captureJobServer()
         await SwiftBuildCommand.main()
     }
 }
@@ -25,6 +25,8 @@ let baseNameWithoutExtension = (try? AbsolutePath(validating: firstArg).basename
 @main
 struct SwiftPM {
     static func main() async {
+        Concurrency.captureJobServer()
+
         // Workaround a bug in Swift 5.9, where multiple executables with an `async` main entrypoint can't be linked
         // into the same test bundle. We're then linking single `swift-package-manager` binary instead and passing
         // executable name via `SWIFTPM_EXEC_NAME`.
@@ -0,0 +1,74 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+@testable import Basics
+import XCTest
+
+import enum TSCBasic.GraphError
+import func TSCBasic.findCycle
+import func TSCBasic.topologicalSort
+
+final class CompactGraphTests: XCTestCase {
+    private let edges: [String: [String]] = [
+        "app": ["lib1", "lib2"],
+        "lib1": ["lib3", "lib2"],
+        "lib2": ["lib3"],
+        "lib3": [],
+        "tests": ["lib1", "app"],
+    ]
+
+    func testStorage() {
+        let graph = CompactGraph(roots: ["app", "tests"]) { self.edges[$0]! }
+        XCTAssertEqual(graph.nodes, ["app", "tests", "lib1", "lib2", "lib3"])
+        XCTAssertEqual(graph.roots, [0, 1])
+        XCTAssertEqual(graph.edgeCount, 7)
+        XCTAssertEqual(graph.successors(of: 0).map { graph.nodes[$0] }, ["lib1", "lib2"])
+        XCTAssertEqual(graph.successors(of: 4).map { graph.nodes[$0] }, [])
+    }
+
+    func testTopologicalSort() throws {
+        for roots in [["app"], ["tests"], ["lib3", "app", "tests", "app"]] {
+            let graph = CompactGraph(roots: roots) { self.edges[$0]! }
+            XCTAssertEqual(try graph.topologicalSort(), try topologicalSort(roots) { self.edges[$0]! })
+        }
+
+        let cyclic = CompactGraph(roots: ["a"]) { ["a": ["b"], "b": ["c"], "c": ["b"]][$0]! }
+        XCTAssertThrowsError(try cyclic.topologicalSort()) { error in
+            XCTAssertEqual(error as? GraphError, .unexpectedCycle)
+        }
+    }
+
+    func testFindCycle() {
+        XCTAssertNil(CompactGraph(roots: ["tests"]) { self.edges[$0]! }.findCycle())
+
+        let edges = ["a": ["b", "d"], "b": ["c"], "c": ["d"], "d": ["e"], "e": ["c"]]
+        let cycle = CompactGraph(roots: ["a"]) { edges[$0]! }.findCycle()
+        let expected = findCycle(["a"]) { edges[$0]! }
+        XCTAssertEqual(cycle?.path, ["a", "b"])
+        XCTAssertEqual(cycle?.cycle, ["c", "d", "e"])
+        XCTAssertEqual(cycle?.path, expected?.path)
+        XCTAssertEqual(cycle?.cycle, expected?.cycle)
+
+        XCTAssertEqual(CompactGraph(roots: ["a"]) { _ in ["a"] }.findCycle()?.cycle, ["a"])
+    }
+
+    func testBitSet() {
+        var set = BitSet(count: 130)
+        XCTAssertTrue(set.insert(0))
+        XCTAssertTrue(set.insert(129))
+        XCTAssertFalse(set.insert(129))
+        XCTAssertTrue(set.contains(0))
+        XCTAssertFalse(set.contains(64))
+        set.remove(129)
+        XCTAssertFalse(set.contains(129))
+    }
+}
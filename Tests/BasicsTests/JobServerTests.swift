@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+@testable import Basics
+import _InternalTestSupport
+import Foundation
+import XCTest
+
+final class JobServerTests: XCTestCase {
+    func testMakeFlags() {
+        XCTAssertNil(JobServer.jobServerAuth(makeFlags: "-j8 -k"))
+        XCTAssertEqual(JobServer.jobServerAuth(makeFlags: " -j8 --jobserver-fds=3,4 -j"), "3,4")
+        XCTAssertEqual(JobServer.jobServerAuth(makeFlags: "-j8 --jobserver-auth=fifo:/tmp/GMfifo1"), "fifo:/tmp/GMfifo1")
+        // The last option wins.
+        XCTAssertEqual(JobServer.jobServerAuth(makeFlags: "--jobserver-auth=3,4 --jobserver-auth=5,6"), "5,6")
+
+        XCTAssertNil(JobServer.inherited(from: [:]))
+        XCTAssertNil(JobServer.inherited(from: ["MAKEFLAGS": "-j8"]))
+        XCTAssertNil(JobServer.inherited(from: ["MAKEFLAGS": "--jobserver-auth=fifo:/nonexistent/fifo"]))
+    }
+
+    func testTokens() throws {
+        #if os(Windows)
+        try XCTSkipIf(true, "jobserver isn't supported on Windows")
+        #endif
+        let pipe = Pipe()
+        let read = pipe.fileHandleForReading.fileDescriptor
+        let write = pipe.fileHandleForWriting.fileDescriptor
+        let jobServer = try XCTUnwrap(JobServer.inherited(from: ["MAKEFLAGS": "-j2 --jobserver-auth=\(read),\(write)"]))
+
+        // The implicit token is handed out first, then the one in the pipe.
+        pipe.fileHandleForWriting.write(Data("+".utf8))
+        let implicit = try jobServer.acquire()
+        let explicit = try jobServer.acquire()
+        jobServer.release(explicit)
+        jobServer.release(implicit)
+        XCTAssertEqual(try jobServer.withToken { 1 }, 1)
+
+        // The byte read from the pipe is written back.
+        pipe.fileHandleForWriting.closeFile()
+        XCTAssertEqual(try jobServer.acquire().byte, nil)
+        XCTAssertEqual(try jobServer.acquire().byte, UInt8(ascii: "+"))
+    }
+
+    func testDescriptorsMustBePipes() throws {
+        #if os(Windows)
+        try XCTSkipIf(true, "jobserver isn't supported on Windows")
+        #endif
+        try testWithTemporaryDirectory { tmpPath in
+            // Descriptors that were reused for regular files aren't mistaken for the jobserver.
+            let path = tmpPath.appending("file")
+            try localFileSystem.writeFileContents(path, string: "")
+            let handle = try FileHandle(forReadingFrom: path.asURL)
+            defer { handle.closeFile() }
+            let descriptor = handle.fileDescriptor
+            XCTAssertNil(JobServer.inherited(from: ["MAKEFLAGS": "--jobserver-auth=\(descriptor),\(descriptor)"]))
+            XCTAssertNil(JobServer.inherited(from: ["MAKEFLAGS": "--jobserver-auth=fifo:\(path.pathString)"]))
+        }
+    }
+}
@@ -22,6 +22,13 @@ import class TSCBasic.InMemoryFileSystem
 import class Basics.AsyncProcess
 import struct Basics.AsyncProcessResult
 
+#if os(Linux)
+/// Writes outside of the writable directories hit the read-only bind mounts of the sandbox.
+fileprivate let deniedWriteMessage = "Read-only file system"
+#else
+fileprivate let deniedWriteMessage = "Operation not permitted"
+#endif
+
 final class SandboxTest: XCTestCase {
     func testSandboxOnAllPlatforms() throws {
         try withTemporaryDirectory { path in
@@ -78,10 +85,30 @@ final class SandboxTest: XCTestCase {
         }
     }
 
-    func testWritableAllowed() throws {
-        #if !os(macOS)
-        try XCTSkipIf(true, "test is only supported on macOS")
+    func testNetworkNotAllowedOnLinux() throws {
+        #if !os(Linux)
+        try XCTSkipIf(true, "test is only supported on Linux")
         #endif
+        try XCTSkipUnless(Sandbox.isAvailable, "bubblewrap is not available")
+
+        // Only the loopback interface of the sandbox's own network namespace is visible.
+        let command = try Sandbox.apply(command: ["cat", "/proc/net/dev"], strictness: .default)
+        let interfaces = try AsyncProcess.checkNonZeroExit(arguments: command)
+            .split(whereSeparator: \.isNewline)
+            .compactMap { $0.split(separator: ":").first.map { $0.trimmingCharacters(in: .whitespaces) } }
+            .filter { !$0.contains("|") }
+        XCTAssertEqual(interfaces, ["lo"])
+
+        let allowedCommand = try Sandbox.apply(
+            command: ["cat", "/proc/net/dev"],
+            strictness: .default,
+            allowNetworkConnections: [.all(ports: [])]
+        )
+        XCTAssertNoThrow(try AsyncProcess.checkNonZeroExit(arguments: allowedCommand))
+    }
+
+    func testWritableAllowed() throws {
+        try XCTSkipUnless(Sandbox.isAvailable, "sandboxing is not supported on this platform")
 
         try withTemporaryDirectory { path in
             let command = try Sandbox.apply(command: ["touch", path.appending(component: UUID().uuidString).pathString], strictness: .default, writableDirectories: [path])
@@ -90,9 +117,7 @@ final class SandboxTest: XCTestCase {
     }
 
     func testWritableNotAllowed() throws {
-        #if !os(macOS)
-        try XCTSkipIf(true, "test is only supported on macOS")
-        #endif
+        try XCTSkipUnless(Sandbox.isAvailable, "sandboxing is not supported on this platform")
 
         try withTemporaryDirectory { path in
             let command = try Sandbox.apply(command: ["touch", path.appending(component: UUID().uuidString).pathString], strictness: .default, writableDirectories: [])
@@ -100,15 +125,13 @@ final class SandboxTest: XCTestCase {
                 guard case AsyncProcessResult.Error.nonZeroExit(let result) = error else {
                     return XCTFail("invalid error \(error)")
                 }
-                XCTAssertMatch(try! result.utf8stderrOutput(), .contains("Operation not permitted"))
+                XCTAssertMatch(try! result.utf8stderrOutput(), .contains(deniedWriteMessage))
             }
         }
     }
 
     func testRemoveNotAllowed() throws {
-        #if !os(macOS)
-        try XCTSkipIf(true, "test is only supported on macOS")
-        #endif
+        try XCTSkipUnless(Sandbox.isAvailable, "sandboxing is not supported on this platform")
 
         try withTemporaryDirectory { path in
             let file = path.appending(component: UUID().uuidString)
@@ -119,16 +142,14 @@ final class SandboxTest: XCTestCase {
                 guard case AsyncProcessResult.Error.nonZeroExit(let result) = error else {
                     return XCTFail("invalid error \(error)")
                 }
-                XCTAssertMatch(try! result.utf8stderrOutput(), .contains("Operation not permitted"))
+                XCTAssertMatch(try! result.utf8stderrOutput(), .contains(deniedWriteMessage))
             }
         }
     }
 
     // FIXME: rdar://75707545 this should not be allowed outside very specific read locations
     func testReadAllowed() throws {
-        #if !os(macOS)
-        try XCTSkipIf(true, "test is only supported on macOS")
-        #endif
+        try XCTSkipUnless(Sandbox.isAvailable, "sandboxing is not supported on this platform")
 
         try withTemporaryDirectory { path in
             let file = path.appending(component: UUID().uuidString)
@@ -141,9 +162,7 @@ final class SandboxTest: XCTestCase {
 
     // FIXME: rdar://75707545 this should not be allowed outside very specific programs
     func testExecuteAllowed() throws {
-        #if !os(macOS)
-        try XCTSkipIf(true, "test is only supported on macOS")
-        #endif
+        try XCTSkipUnless(Sandbox.isAvailable, "sandboxing is not supported on this platform")
 
         try withTemporaryDirectory { path in
             let file = path.appending(component: UUID().uuidString)
@@ -156,9 +175,7 @@ final class SandboxTest: XCTestCase {
     }
 
     func testWritingToTemporaryDirectoryAllowed() throws {
-        #if !os(macOS)
-        try XCTSkipIf(true, "test is only supported on macOS")
-        #endif
+        try XCTSkipUnless(Sandbox.isAvailable, "sandboxing is not supported on this platform")
 
         // Try writing to the per-user temporary directory, which is under /var/folders/.../TemporaryItems.
         let tmpFile1 = NSTemporaryDirectory() + "/" + UUID().uuidString
@@ -173,9 +190,7 @@ final class SandboxTest: XCTestCase {
     }
 
     func testWritingToReadOnlyInsideWritableNotAllowed() throws {
-        #if !os(macOS)
-        try XCTSkipIf(true, "sandboxing is only supported on macOS")
-        #endif
+        try XCTSkipUnless(Sandbox.isAvailable, "sandboxing is not supported on this platform")
 
         try withTemporaryDirectory { tmpDir in
             // Check that we can write into the temporary directory, but not into a read-only directory underneath it.
@@ -192,15 +207,13 @@ final class SandboxTest: XCTestCase {
                 guard case AsyncProcessResult.Error.nonZeroExit(let result) = error else {
                     return XCTFail("invalid error \(error)")
                 }
-                XCTAssertMatch(try! result.utf8stderrOutput(), .contains("Operation not permitted"))
+                XCTAssertMatch(try! result.utf8stderrOutput(), .contains(deniedWriteMessage))
             }
         }
     }
 
     func testWritingToWritableInsideReadOnlyAllowed() throws {
-         #if !os(macOS)
-         try XCTSkipIf(true, "sandboxing is only supported on macOS")
-         #endif
+         try XCTSkipUnless(Sandbox.isAvailable, "sandboxing is not supported on this platform")
 
          try withTemporaryDirectory { tmpDir in
              // Check that we cannot write into a read-only directory, but into a writable directory underneath it.
@@ -211,7 +224,7 @@ final class SandboxTest: XCTestCase {
                  guard case AsyncProcessResult.Error.nonZeroExit(let result) = error else {
                      return XCTFail("invalid error \(error)")
                  }
-                 XCTAssertMatch(try! result.utf8stderrOutput(), .contains("Operation not permitted"))
+                 XCTAssertMatch(try! result.utf8stderrOutput(), .contains(deniedWriteMessage))
              }
 
              // Check that we can write into a writable directory underneath it.
@@ -616,6 +616,112 @@ final class URLSessionHTTPClientTest: XCTestCase {
         XCTAssertEqual(response.body, responseBody)
     }
 
+    func testAsyncGetManyChunks() async throws {
+        let configuration = URLSessionConfiguration.ephemeral
+        configuration.protocolClasses = [MockURLProtocol.self]
+        let urlSession = URLSessionHTTPClient(configuration: configuration)
+        let httpClient = HTTPClient(implementation: urlSession.execute)
+
+        let url = URL("http://async-get-many-chunks-test")
+        // Large enough that copying the body received so far with every chunk times out the test.
+        let chunks = (0 ..< 1024).map { Data(repeating: UInt8(truncatingIfNeeded: $0), count: 16 * 1024) }
+        let responseBody = chunks.reduce(Data(), +)
+
+        MockURLProtocol.onRequest("GET", url) { request in
+            MockURLProtocol.sendResponse(
+                statusCode: 200,
+                headers: ["Content-Length": "\(responseBody.count)"],
+                for: request
+            )
+            for chunk in chunks {
+                MockURLProtocol.sendData(chunk, for: request)
+            }
+            MockURLProtocol.sendCompletion(for: request)
+        }
+
+        let lastProgress = ThreadSafeBox<Int64>()
+        let response = try await httpClient.execute(.init(method: .get, url: url)) { bytesDownloaded, _ in
+            lastProgress.put(bytesDownloaded)
+        }
+        XCTAssertEqual(response.statusCode, 200)
+        XCTAssertEqual(response.body, responseBody)
+        XCTAssertEqual(lastProgress.get(), Int64(responseBody.count))
+    }
+
+    func testSlowCallbacksDontBlockOtherRequests() {
+        let configuration = URLSessionConfiguration.ephemeral
+        configuration.protocolClasses = [MockURLProtocol.self]
+        let urlSession = URLSessionHTTPClient(configuration: configuration)
+
+        let slowURL = URL("http://slow-callbacks-test")
+        let fastURL = URL("http://fast-callbacks-test")
+        for url in [slowURL, fastURL] {
+            MockURLProtocol.onRequest("GET", url) { request in
+                MockURLProtocol.respond(request, statusCode: 200, body: Data(url.absoluteString.utf8))
+            }
+        }
+
+        // The progress handler of the slow request is blocked until the fast request completes, which it can't if
+        // the handlers of both requests run one at a time.
+        let slowRequestBlocked = XCTestExpectation(description: "slow request blocked")
+        let slowRequestCompleted = XCTestExpectation(description: "slow request completed")
+        let fastRequestCompleted = XCTestExpectation(description: "fast request completed")
+        let unblockSlowRequest = DispatchSemaphore(value: 0)
+        urlSession.execute(
+            .init(method: .get, url: slowURL),
+            progress: { bytesReceived, _ in
+                guard bytesReceived > 0 else { return }
+                slowRequestBlocked.fulfill()
+                unblockSlowRequest.wait()
+            },
+            completion: { result in
+                XCTAssertEqual(try? result.get().body, Data(slowURL.absoluteString.utf8))
+                slowRequestCompleted.fulfill()
+            }
+        )
+        wait(for: [slowRequestBlocked], timeout: 1.0)
+
+        urlSession.execute(.init(method: .get, url: fastURL), progress: nil) { result in
+            XCTAssertEqual(try? result.get().body, Data(fastURL.absoluteString.utf8))
+            fastRequestCompleted.fulfill()
+        }
+        wait(for: [fastRequestCompleted], timeout: 1.0)
+
+        unblockSlowRequest.signal()
+        wait(for: [slowRequestCompleted], timeout: 1.0)
+    }
+
+    func testHandlersOfParallelRequestsRunConcurrently() {
+        let configuration = URLSessionConfiguration.ephemeral
+        configuration.protocolClasses = [MockURLProtocol.self]
+        let urlSession = URLSessionHTTPClient(configuration: configuration)
+
+        // The completion handler of every request is blocked until the completion handlers of all requests are
+        // running, which they can only be if the handlers of different requests run in parallel.
+        let urls = (0 ..< 16).map { URL("http://parallel-requests-test-\($0)") }
+        let body = Data(repeating: 0xBE, count: 64 * 1024)
+        let handlersRunning = urls.map { XCTestExpectation(description: "\($0.absoluteString) handler running") }
+        let completions = urls.map { XCTestExpectation(description: "\($0.absoluteString) completed") }
+        let unblockHandlers = DispatchSemaphore(value: 0)
+        for (url, (handlerRunning, completion)) in zip(urls, zip(handlersRunning, completions)) {
+            MockURLProtocol.onRequest("GET", url) { request in
+                MockURLProtocol.respond(request, statusCode: 200, headers: ["Content-Length": "\(body.count)"], body: body)
+            }
+            urlSession.execute(.init(method: .get, url: url), progress: nil) { result in
+                XCTAssertEqual(try? result.get().body, body)
+                handlerRunning.fulfill()
+                unblockHandlers.wait()
+                completion.fulfill()
+            }
+        }
+        wait(for: handlersRunning, timeout: 1.0)
+
+        for _ in urls {
+            unblockHandlers.signal()
+        }
+        wait(for: completions, timeout: 1.0)
+    }
+
     func testAsyncPost() async throws {
         let configuration = URLSessionConfiguration.ephemeral
         configuration.protocolClasses = [MockURLProtocol.self]
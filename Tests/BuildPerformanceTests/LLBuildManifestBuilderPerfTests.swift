@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import Basics
+import Build
+
+@_spi(DontAdoptOutsideOfSwiftPMExposedForBenchmarksAndTestsOnly)
+import PackageGraph
+
+import PackageModel
+import _InternalTestSupport
+import XCTest
+
+import class TSCBasic.InMemoryFileSystem
+
+import class TSCTestSupport.XCTestCasePerf
+
+/// Measures build planning and manifest generation for synthetic packages of increasing size. Every tenth module
+/// is an executable that the following library modules depend on, so executable lookups are exercised too. The
+/// time taken should grow linearly with the number of modules.
+final class LLBuildManifestBuilderPerfTests: XCTestCasePerf {
+    func testManifestGeneration500Modules() throws {
+        try self.runManifestGeneration(modulesCount: 500)
+    }
+
+    func testManifestGeneration2000Modules() throws {
+        try self.runManifestGeneration(modulesCount: 2000)
+    }
+
+    func testManifestGeneration5000Modules() throws {
+        try self.runManifestGeneration(modulesCount: 5000)
+    }
+
+    private func runManifestGeneration(modulesCount: Int) throws {
+        let packagePath = AbsolutePath("/Pkg")
+        var files = [String]()
+        var targets = [TargetDescription]()
+        var lastExecutable: String?
+        for i in 0..<modulesCount {
+            let isExecutable = i % 10 == 0
+            let name = isExecutable ? "Exec\(i)" : "Module\(i)"
+            var dependencies: [TargetDescription.Dependency] = (max(0, i - 3)..<i)
+                .filter { $0 % 10 != 0 }
+                .map { .target(name: "Module\($0)") }
+            if !isExecutable, let lastExecutable {
+                dependencies.append(.target(name: lastExecutable))
+            }
+            files.append(packagePath.appending(components: "Sources", name, isExecutable ? "main.swift" : "source.swift").pathString)
+            targets.append(try TargetDescription(
+                name: name,
+                dependencies: dependencies,
+                type: isExecutable ? .executable : .regular
+            ))
+            if isExecutable {
+                lastExecutable = name
+            }
+        }
+
+        let fs = InMemoryFileSystem(emptyFiles: files)
+        let observability = ObservabilitySystem.makeForTesting()
+        let graph = try loadModulesGraph(
+            fileSystem: fs,
+            manifests: [
+                Manifest.createRootManifest(
+                    displayName: "Pkg",
+                    path: packagePath,
+                    targets: targets
+                ),
+            ],
+            observabilityScope: observability.topScope
+        )
+        XCTAssertNoDiagnostics(observability.diagnostics)
+
+        measure {
+            do {
+                let plan = try mockBuildPlan(
+                    graph: graph,
+                    fileSystem: fs,
+                    observabilityScope: observability.topScope
+                )
+                let builder = LLBuildManifestBuilder(
+                    plan,
+                    fileSystem: fs,
+                    observabilityScope: observability.topScope
+                )
+                _ = try builder.generateManifest(at: "/manifest.yaml")
+            } catch {
+                XCTFail("Manifest generation is not expected to fail in this test: \(error)")
+            }
+        }
+    }
+}
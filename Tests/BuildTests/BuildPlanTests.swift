@@ -2109,6 +2109,73 @@ final class BuildPlanTests: XCTestCase {
         }
     }
 
+    func testIsolatedModuleSearchPaths() throws {
+        // ModuleGraph:
+        // .
+        // ├── A (Swift)
+        // │   └── B (Swift)
+        // │       └── C (Swift)
+        // └── D (Swift)
+
+        let Pkg: AbsolutePath = "/Pkg"
+        let fs = InMemoryFileSystem(
+            emptyFiles:
+            Pkg.appending(components: "Sources", "A", "A.swift").pathString,
+            Pkg.appending(components: "Sources", "B", "B.swift").pathString,
+            Pkg.appending(components: "Sources", "C", "C.swift").pathString,
+            Pkg.appending(components: "Sources", "D", "D.swift").pathString
+        )
+
+        let observability = ObservabilitySystem.makeForTesting()
+        let graph = try loadModulesGraph(
+            fileSystem: fs,
+            manifests: [
+                Manifest.createRootManifest(
+                    displayName: "Pkg",
+                    path: .init(validating: Pkg.pathString),
+                    targets: [
+                        TargetDescription(name: "A", dependencies: ["B"]),
+                        TargetDescription(name: "B", dependencies: ["C"]),
+                        TargetDescription(name: "C", dependencies: []),
+                        TargetDescription(name: "D", dependencies: []),
+                    ]
+                ),
+            ],
+            observabilityScope: observability.topScope
+        )
+        XCTAssertNoDiagnostics(observability.diagnostics)
+
+        let plan = try mockBuildPlan(
+            graph: graph,
+            driverParameters: .init(useIsolatedModuleSearchPaths: true),
+            fileSystem: fs,
+            observabilityScope: observability.topScope
+        )
+
+        let result = try BuildPlanResult(plan: plan)
+        let buildPath = plan.productsBuildPath
+
+        let a = try result.moduleBuildDescription(for: "A").swift()
+        let dependencyModulesPath = buildPath.appending(components: "A.build", "DependencyModules")
+        let commandLine = try a.emitCommandLine()
+        XCTAssertMatch(
+            commandLine,
+            [.anySequence, "-I", .equal(dependencyModulesPath.pathString), .anySequence]
+        )
+        XCTAssertNoMatch(
+            commandLine,
+            [.anySequence, "-I", .equal(buildPath.appending("Modules").pathString), .anySequence]
+        )
+        XCTAssertEqual(
+            try fs.getDirectoryContents(dependencyModulesPath).sorted(),
+            ["B.swiftmodule", "C.swiftmodule"]
+        )
+        XCTAssertTrue(fs.isSymlink(dependencyModulesPath.appending("B.swiftmodule")))
+
+        let d = try result.moduleBuildDescription(for: "D").swift()
+        XCTAssertEqual(try fs.getDirectoryContents(d.dependencyModulesPath), [])
+    }
+
     func testREPLArguments() throws {
         let Dep = AbsolutePath("/Dep")
         let fs = InMemoryFileSystem(
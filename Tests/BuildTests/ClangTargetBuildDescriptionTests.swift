@@ -51,6 +51,53 @@ final class ClangTargetBuildDescriptionTests: XCTestCase {
         XCTAssertTrue(try targetDescription.basicArguments().contains("-w"))
     }
 
+    func testSplitDWARF() throws {
+        func makeParameters(triple: Basics.Triple) -> BuildParameters {
+            var parameters = mockBuildParameters(destination: .target, triple: triple)
+            parameters.debuggingParameters = .init(
+                triple: triple,
+                shouldEnableDebuggingEntitlement: false,
+                omitFramePointers: nil,
+                shouldSplitDWARF: true,
+                shouldCompressDebugSections: true
+            )
+            return parameters
+        }
+
+        let linuxDescription = try makeTargetBuildDescription("test", buildParameters: makeParameters(triple: .arm64Linux))
+        XCTAssertTrue(try linuxDescription.basicArguments().contains("-gsplit-dwarf"))
+        XCTAssertTrue(try linuxDescription.basicArguments().contains("-gz"))
+        let object = try XCTUnwrap(linuxDescription.objects.first)
+        XCTAssertEqual(
+            linuxDescription.splitDWARFPath(forObject: object),
+            object.parentDirectory.appending("foo.c.dwo")
+        )
+
+        // Split DWARF is only supported on ELF platforms.
+        let macDescription = try makeTargetBuildDescription("test", buildParameters: makeParameters(triple: .macOS))
+        XCTAssertFalse(try macDescription.basicArguments().contains("-gsplit-dwarf"))
+        XCTAssertFalse(try macDescription.basicArguments().contains("-gz"))
+        XCTAssertNil(macDescription.splitDWARFPath(forObject: object))
+    }
+
+    func testPathPrefixMappings() throws {
+        var parameters = mockBuildParameters(destination: .target, triple: .arm64Linux)
+        parameters.debuggingParameters = .init(
+            triple: .arm64Linux,
+            shouldEnableDebuggingEntitlement: false,
+            omitFramePointers: nil,
+            pathPrefixMappings: [
+                .init(path: "/Package", replacement: "."),
+                .init(path: "/tmp/scratch", replacement: ".build"),
+            ]
+        )
+
+        let targetDescription = try makeTargetBuildDescription("test", buildParameters: parameters)
+        let arguments = try targetDescription.basicArguments()
+        XCTAssertTrue(arguments.contains("-ffile-prefix-map=/Package=."))
+        XCTAssertTrue(arguments.contains("-ffile-prefix-map=/tmp/scratch=.build"))
+    }
+
     private func makeClangTarget() throws -> ClangModule {
         try ClangModule(
             name: "dummy",
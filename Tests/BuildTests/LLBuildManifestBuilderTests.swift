@@ -193,6 +193,142 @@ final class LLBuildManifestBuilderTests: XCTestCase {
         )
     }
     
+    func testSkipSnippetLinking() throws {
+        let fs = InMemoryFileSystem(emptyFiles:
+            "/Pkg/Sources/Lib/lib.swift",
+            "/Pkg/Snippets/Hello.swift"
+        )
+
+        let observability = ObservabilitySystem.makeForTesting()
+        let graph = try loadModulesGraph(
+            fileSystem: fs,
+            manifests: [
+                Manifest.createRootManifest(
+                    displayName: "Pkg",
+                    path: "/Pkg",
+                    toolsVersion: .v5_7,
+                    products: [ProductDescription(name: "Lib", type: .library(.automatic), targets: ["Lib"])],
+                    targets: [TargetDescription(name: "Lib")]
+                ),
+            ],
+            observabilityScope: observability.topScope
+        )
+        XCTAssertNoDiagnostics(observability.diagnostics)
+
+        for shouldLinkSnippets in [true, false] {
+            let plan = try mockBuildPlan(
+                environment: BuildEnvironment(platform: .linux, configuration: .debug),
+                graph: graph,
+                linkingParameters: .init(shouldLinkSnippets: shouldLinkSnippets),
+                fileSystem: fs,
+                observabilityScope: observability.topScope
+            )
+            let triple = plan.destinationBuildParameters.triple
+            let manifest = try LLBuildManifestBuilder(plan, fileSystem: fs, observabilityScope: observability.topScope)
+                .generateManifest(at: "/manifest")
+            let mainNodes = try XCTUnwrap(manifest.targets[LLBuildManifestBuilder.TargetKind.main.targetName]).nodes
+
+            // The snippet is always compiled, and can always be linked on its own.
+            XCTAssertTrue(mainNodes.contains(.virtual("Hello-\(triple)-debug.module")))
+            XCTAssertNotNil(manifest.commands["C.Hello-\(triple)-debug.exe"])
+            XCTAssertEqual(mainNodes.contains(.virtual("Hello-\(triple)-debug.exe")), shouldLinkSnippets)
+        }
+    }
+
+    func testLimitedLinkJobs() throws {
+        let fs = InMemoryFileSystem(emptyFiles: "/Pkg/Sources/exe/main.swift")
+
+        let observability = ObservabilitySystem.makeForTesting()
+        let graph = try loadModulesGraph(
+            fileSystem: fs,
+            manifests: [
+                Manifest.createRootManifest(
+                    displayName: "Pkg",
+                    path: "/Pkg",
+                    targets: [TargetDescription(name: "exe", type: .executable)]
+                ),
+            ],
+            observabilityScope: observability.topScope
+        )
+        XCTAssertNoDiagnostics(observability.diagnostics)
+
+        for maxConcurrentLinkJobs in [nil, 2] {
+            let plan = try mockBuildPlan(
+                environment: BuildEnvironment(platform: .linux, configuration: .debug),
+                graph: graph,
+                linkingParameters: .init(maxConcurrentLinkJobs: maxConcurrentLinkJobs),
+                fileSystem: fs,
+                observabilityScope: observability.topScope
+            )
+            let triple = plan.destinationBuildParameters.triple
+            let manifest = try LLBuildManifestBuilder(plan, fileSystem: fs, observabilityScope: observability.topScope)
+                .generateManifest(at: "/manifest")
+
+            // Limited link commands are run by SwiftPM, with the same arguments as the shell command.
+            let tool = try XCTUnwrap(manifest.commands["C.exe-\(triple)-debug.exe"]).tool
+            let linkArguments = try BuildPlanResult(plan: plan).buildProduct(for: "exe").linkArguments()
+            if maxConcurrentLinkJobs == nil {
+                XCTAssertEqual((tool as? ShellTool)?.arguments, linkArguments)
+            } else {
+                XCTAssertEqual((tool as? LinkTool)?.arguments, linkArguments)
+            }
+        }
+    }
+
+    func testPrioritizeCriticalPath() throws {
+        let fs = InMemoryFileSystem(
+            emptyFiles:
+            "/Pkg/Sources/exe/main.swift",
+            "/Pkg/Sources/Lib/Lib.swift",
+            "/Pkg/Sources/Other/Other.swift"
+        )
+
+        let observability = ObservabilitySystem.makeForTesting()
+        let graph = try loadModulesGraph(
+            fileSystem: fs,
+            manifests: [
+                Manifest.createRootManifest(
+                    displayName: "Pkg",
+                    path: "/Pkg",
+                    targets: [
+                        TargetDescription(name: "exe", dependencies: ["Lib"], type: .executable),
+                        TargetDescription(name: "Lib"),
+                        TargetDescription(name: "Other"),
+                    ]
+                ),
+            ],
+            observabilityScope: observability.topScope
+        )
+        XCTAssertNoDiagnostics(observability.diagnostics)
+
+        let plan = try mockBuildPlan(
+            environment: BuildEnvironment(platform: .linux, configuration: .debug),
+            graph: graph,
+            fileSystem: fs,
+            observabilityScope: observability.topScope
+        )
+        let triple = plan.destinationBuildParameters.triple
+        let manifest = try LLBuildManifestBuilder(
+            plan,
+            fileSystem: fs,
+            observabilityScope: observability.topScope,
+            commandDurations: ["C.Lib-\(triple)-debug.module": 100, "C.Other-\(triple)-debug.module": 10]
+        ).generateManifest(at: "/manifest")
+        let mainNodes = try XCTUnwrap(manifest.targets[LLBuildManifestBuilder.TargetKind.main.targetName]).nodes
+
+        // The nodes of the target are phony, so the executable and everything that depends on the slow module are
+        // ranked by the module, before the faster module nothing depends on.
+        XCTAssertEqual(
+            Set(mainNodes.prefix(3)),
+            [
+                .virtual("exe-\(triple)-debug.exe"),
+                .virtual("exe-\(triple)-debug.module"),
+                .virtual("Lib-\(triple)-debug.module"),
+            ]
+        )
+        XCTAssertEqual(mainNodes.dropFirst(3).first, .virtual("Other-\(triple)-debug.module"))
+    }
+
     /// Verifies that two modules with the same name but different triples don't share same build manifest keys.
     func testToolsBuildTriple() throws {
         let (graph, fs, scope) = try macrosPackageGraph()
@@ -16,8 +16,12 @@ import Build
 import class Basics.ObservabilitySystem
 import class TSCBasic.InMemoryFileSystem
 
+import enum PackageModel.BuildConfiguration
 import class PackageModel.Manifest
+import struct PackageModel.ProductDescription
+import struct PackageModel.Platform
 import struct PackageModel.TargetDescription
+import struct SPMBuildCore.BuildParameters
 
 @testable
 import struct PackageGraph.ResolvedProduct
@@ -74,4 +78,155 @@ final class ProductBuildDescriptionTests: XCTestCase {
                 .contains("-enable-experimental-feature Embedded")
         )
     }
+
+    func testLinkerSelection() throws {
+        let fs = InMemoryFileSystem(
+            emptyFiles:
+            "/Pkg/Sources/exe/main.swift"
+        )
+
+        let observability = ObservabilitySystem.makeForTesting()
+        let graph = try loadModulesGraph(
+            fileSystem: fs,
+            manifests: [
+                Manifest.createRootManifest(
+                    displayName: "Pkg",
+                    path: "/Pkg",
+                    targets: [
+                        TargetDescription(name: "exe"),
+                    ]
+                ),
+            ],
+            observabilityScope: observability.topScope
+        )
+        XCTAssertNoDiagnostics(observability.diagnostics)
+
+        let id = ResolvedProduct.ID(productName: "exe", packageIdentity: .plain("pkg"), buildTriple: .destination)
+        let package = try XCTUnwrap(graph.rootPackages.first)
+        let product = try XCTUnwrap(graph.allProducts[id])
+
+        func linkArguments(
+            platform: Platform,
+            linker: BuildParameters.Linker?,
+            swiftCompilerFlags: [String] = []
+        ) throws -> String {
+            var buildParameters = mockBuildParameters(destination: .target, environment: .init(platform: platform))
+            buildParameters.flags.swiftCompilerFlags = swiftCompilerFlags
+            buildParameters.linkingParameters.linker = linker
+            buildParameters.linkingParameters.linkerThreads = 4
+
+            let buildDescription = try ProductBuildDescription(
+                package: package,
+                product: product,
+                toolsVersion: .v5_9,
+                buildParameters: buildParameters,
+                fileSystem: fs,
+                observabilityScope: observability.topScope
+            )
+            return try buildDescription.linkArguments().joined(separator: " ")
+        }
+
+        XCTAssertTrue(try linkArguments(platform: .linux, linker: .lld).contains("-use-ld=lld -Xlinker --threads=4"))
+        XCTAssertTrue(
+            try linkArguments(platform: .linux, linker: .mold).contains("-use-ld=mold -Xlinker --thread-count=4")
+        )
+        XCTAssertFalse(try linkArguments(platform: .linux, linker: nil).contains("-use-ld="))
+        // Darwin always uses the system linker.
+        XCTAssertFalse(try linkArguments(platform: .macOS, linker: .lld).contains("-use-ld="))
+
+        // A linker selected by flags wins, and doesn't get the thread options of the selected one.
+        for flags in [["-use-ld=lld"], ["-Xclang-linker", "-fuse-ld=lld"]] {
+            let arguments = try linkArguments(platform: .linux, linker: .mold, swiftCompilerFlags: flags)
+            XCTAssertFalse(arguments.contains("-use-ld=mold"))
+            XCTAssertFalse(arguments.contains("--thread-count"))
+        }
+    }
+
+    func testThinArchives() throws {
+        #if os(Windows)
+        try XCTSkipIf(true, "archives aren't replaced through a shell on Windows")
+        #endif
+        let fs = InMemoryFileSystem(
+            emptyFiles:
+            "/Pkg/Sources/lib/lib.swift"
+        )
+
+        let observability = ObservabilitySystem.makeForTesting()
+        let graph = try loadModulesGraph(
+            fileSystem: fs,
+            manifests: [
+                Manifest.createRootManifest(
+                    displayName: "Pkg",
+                    path: "/Pkg",
+                    products: [
+                        ProductDescription(name: "lib", type: .library(.static), targets: ["lib"]),
+                    ],
+                    targets: [
+                        TargetDescription(name: "lib"),
+                    ]
+                ),
+            ],
+            observabilityScope: observability.topScope
+        )
+        XCTAssertNoDiagnostics(observability.diagnostics)
+
+        let id = ResolvedProduct.ID(productName: "lib", packageIdentity: .plain("pkg"), buildTriple: .destination)
+        let package = try XCTUnwrap(graph.rootPackages.first)
+        let product = try XCTUnwrap(graph.allProducts[id])
+
+        func makeBuildDescription(
+            platform: PackageModel.Platform = .linux,
+            configuration: BuildConfiguration,
+            shouldUseThinArchives: Bool = true
+        ) throws -> ProductBuildDescription {
+            var buildParameters = mockBuildParameters(
+                destination: .target,
+                environment: .init(platform: platform, configuration: configuration)
+            )
+            buildParameters.linkingParameters.shouldUseThinArchives = shouldUseThinArchives
+
+            return try ProductBuildDescription(
+                package: package,
+                product: product,
+                toolsVersion: .v5_9,
+                buildParameters: buildParameters,
+                fileSystem: fs,
+                observabilityScope: observability.topScope
+            )
+        }
+
+        // The archive is recreated, since `ar` can't convert a regular archive left behind in place.
+        let debug = try makeBuildDescription(configuration: .debug)
+        let librarian = debug.buildParameters.toolchain.librarianPath.pathString
+        let binaryPath = try debug.binaryPath.pathString
+        let linkFileList = "@\(debug.linkFileListPath.pathString)"
+        XCTAssertTrue(debug.usesThinArchive)
+        XCTAssertEqual(try debug.archiveArguments(), [
+            "/bin/sh", "-c", #"rm -f "$0" && touch "$1" && shift && exec "$@""#,
+            binaryPath, debug.thinArchiveMarkerPath.pathString,
+            librarian, "crsT", binaryPath, linkFileList,
+        ])
+
+        // Apple linkers don't support thin archives.
+        let apple = try makeBuildDescription(platform: .macOS, configuration: .debug)
+        XCTAssertFalse(apple.usesThinArchive)
+        XCTAssertFalse(try apple.archiveArguments().contains("crsT"))
+
+        // Release builds always produce self-contained archives.
+        let release = try makeBuildDescription(configuration: .release)
+        XCTAssertFalse(release.usesThinArchive)
+        XCTAssertEqual(try release.archiveArguments().dropFirst().first, "crs")
+
+        // Without thin archives, archives are only recreated when a thin archive may have been left behind.
+        let regular = try makeBuildDescription(configuration: .debug, shouldUseThinArchives: false)
+        XCTAssertFalse(regular.usesThinArchive)
+        XCTAssertEqual(try regular.archiveArguments(), [librarian, "crs", binaryPath, linkFileList])
+        try fs.createDirectory(debug.thinArchiveMarkerPath.parentDirectory, recursive: true)
+        try fs.writeFileContents(debug.thinArchiveMarkerPath, string: "")
+        XCTAssertEqual(try regular.archiveArguments(), [
+            "/bin/sh", "-c", #"rm -f "$0" "$1" && shift && exec "$@""#,
+            binaryPath, debug.thinArchiveMarkerPath.pathString,
+            librarian, "crs", binaryPath, linkFileList,
+        ])
+    }
 }
@@ -914,6 +914,65 @@ final class PackageCommandTests: CommandsTestCase {
             XCTAssertMatch(contents, .contains(#""MyLib""#))
         }
     }
+
+    func testPackageApplyEdits() async throws {
+        try await testWithTemporaryDirectory { tmpPath in
+            let fs = localFileSystem
+            let path = tmpPath.appending("PackageB")
+            let otherPath = tmpPath.appending("PackageC")
+            for (packagePath, name) in [(path, "client"), (otherPath, "other")] {
+                try fs.createDirectory(packagePath)
+                try fs.writeFileContents(packagePath.appending("Package.swift"), string:
+                    """
+                    // swift-tools-version: 5.9
+                    import PackageDescription
+                    let package = Package(
+                        name: "\(name)"
+                    )
+                    """
+                )
+            }
+
+            let editsFile = tmpPath.appending("edits.json")
+            try fs.writeFileContents(editsFile, string:
+                """
+                [
+                    { "arguments": ["add-target", "MyLib"] },
+                    { "arguments": ["add-product", "MyLib", "--targets", "MyLib"] },
+                    { "arguments": ["add-target", "client", "--type", "executable"] },
+                    { "arguments": ["add-target-dependency", "MyLib", "client"] },
+                    { "package": "\(otherPath)", "arguments": ["add-target", "OtherLib"] }
+                ]
+                """
+            )
+            _ = try await execute(["apply-edits", editsFile.pathString], packagePath: path)
+
+            let contents: String = try fs.readFileContents(path.appending("Package.swift"))
+            XCTAssertMatch(contents, .contains(#"name: "MyLib""#))
+            XCTAssertMatch(contents, .contains(#".executableTarget"#))
+            XCTAssertMatch(contents, .contains(#"dependencies: ["#))
+            XCTAssertFileExists(path.appending(components: "Sources", "MyLib", "MyLib.swift"))
+            let otherContents: String = try fs.readFileContents(otherPath.appending("Package.swift"))
+            XCTAssertMatch(otherContents, .contains(#"name: "OtherLib""#))
+
+            // A conflicting edit fails the whole batch without writing anything.
+            try fs.writeFileContents(editsFile, string:
+                """
+                [
+                    { "arguments": ["add-target", "Another"] },
+                    { "arguments": ["add-target", "MyLib"] }
+                ]
+                """
+            )
+            await XCTAssertThrowsCommandExecutionError(
+                try await execute(["apply-edits", editsFile.pathString], packagePath: path)
+            ) { error in
+                XCTAssertMatch(error.stderr, .contains("edit #2 failed: package already has a target named 'MyLib'"))
+            }
+            let unchangedContents: String = try fs.readFileContents(path.appending("Package.swift"))
+            XCTAssertEqual(unchangedContents, contents)
+        }
+    }
     func testPackageEditAndUnedit() async throws {
         try await fixture(name: "Miscellaneous/PackageEdit") { fixturePath in
             let fooPath = fixturePath.appending("foo")
@@ -0,0 +1,128 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import Basics
+
+@_spi(DontAdoptOutsideOfSwiftPMExposedForBenchmarksAndTestsOnly)
+import func PackageGraph.loadModulesGraph
+
+import PackageModel
+import _InternalTestSupport
+
+@testable
+import Commands
+
+import XCTest
+
+import class TSCBasic.BufferedOutputByteStream
+import class TSCBasic.InMemoryFileSystem
+
+final class PackageGraphSnapshotTests: XCTestCase {
+    func testSnapshot() throws {
+        func makeFileSystem() throws -> InMemoryFileSystem {
+            let fileSystem = InMemoryFileSystem(emptyFiles: [
+                "/App/Sources/App/main.swift",
+                "/App/Sources/Lib/lib.swift",
+                "/App/Snippets/Snippet.swift",
+                "/Dep/Sources/Dep/dep.swift",
+            ])
+            try fileSystem.writeFileContents("/App/Package.swift", string: "// App")
+            try fileSystem.writeFileContents("/App/Package.resolved", string: "{}")
+            try fileSystem.writeFileContents("/Dep/Package.swift", string: "// Dep")
+            try fileSystem.createDirectory("/App/.build")
+            return fileSystem
+        }
+        let fileSystem = try makeFileSystem()
+
+        let observability = ObservabilitySystem.makeForTesting()
+        let graph = try loadModulesGraph(
+            fileSystem: fileSystem,
+            manifests: [
+                Manifest.createRootManifest(
+                    displayName: "App",
+                    path: "/App",
+                    toolsVersion: .v5_7,
+                    dependencies: [.fileSystem(path: "/Dep")],
+                    targets: [
+                        TargetDescription(name: "App", dependencies: ["Lib"], type: .executable),
+                        TargetDescription(name: "Lib", dependencies: [.product(name: "Dep", package: "Dep")]),
+                    ]
+                ),
+                Manifest.createFileSystemManifest(
+                    displayName: "Dep",
+                    path: "/Dep",
+                    toolsVersion: .v5_7,
+                    products: [ProductDescription(name: "Dep", type: .library(.automatic), targets: ["Dep"])],
+                    targets: [TargetDescription(name: "Dep")]
+                ),
+            ],
+            observabilityScope: observability.topScope
+        )
+        XCTAssertNoDiagnostics(observability.diagnostics)
+
+        let snapshot = PackageGraphSnapshot(
+            graph: graph,
+            rootPaths: ["/App"],
+            inputPaths: [
+                "/App/Package.resolved",
+                "/App/.build/workspace-state.json",
+                "/App/.swiftpm/configuration/mirrors.json",
+            ],
+            toolchain: "toolchain",
+            fileSystem: fileSystem
+        )
+        let rootPackage = try XCTUnwrap(snapshot.rootPackage)
+        XCTAssertEqual(rootPackage.identity, .plain("app"))
+        XCTAssertEqual(rootPackage.executables, ["App"])
+        XCTAssertEqual(rootPackage.snippets, ["Snippet"])
+        XCTAssertEqual(snapshot.directDependencies(for: rootPackage).map(\.identity), [.plain("dep")])
+
+        // The snapshot round-trips and is up to date until one of its inputs changes.
+        let decoded = try JSONDecoder.makeWithDefaults().decode(
+            PackageGraphSnapshot.self,
+            from: JSONEncoder.makeWithDefaults().encode(snapshot)
+        )
+        XCTAssertEqual(decoded, snapshot)
+        XCTAssertTrue(snapshot.isUpToDate(rootPaths: ["/App"], toolchain: "toolchain", fileSystem: fileSystem))
+        XCTAssertFalse(snapshot.isUpToDate(rootPaths: ["/Dep"], toolchain: "toolchain", fileSystem: fileSystem))
+        XCTAssertFalse(snapshot.isUpToDate(rootPaths: ["/App"], toolchain: "other", fileSystem: fileSystem))
+
+        let changes: [(path: AbsolutePath, contents: String)] = [
+            ("/App/Package.resolved", "{ }"),
+            ("/App/.build/workspace-state.json", "{}"),
+            ("/App/Package@swift-6.0.swift", "// App"),
+            ("/Dep/Package.swift", "// Changed"),
+            ("/App/.swiftpm/configuration/mirrors.json", "{}"),
+            ("/App/Snippets/Group/Other.swift", ""),
+        ]
+        for change in changes {
+            let fileSystem = try makeFileSystem()
+            XCTAssertTrue(snapshot.isUpToDate(rootPaths: ["/App"], toolchain: "toolchain", fileSystem: fileSystem))
+            try fileSystem.createDirectory(change.path.parentDirectory, recursive: true)
+            try fileSystem.writeFileContents(change.path, string: change.contents)
+            XCTAssertFalse(
+                snapshot.isUpToDate(rootPaths: ["/App"], toolchain: "toolchain", fileSystem: fileSystem),
+                "\(change.path)"
+            )
+        }
+
+        // Dependencies are listed from the snapshot the same way as from the graph.
+        let output = BufferedOutputByteStream()
+        SwiftPackageCommand.ShowDependencies.dumpDependenciesOf(
+            graph: snapshot,
+            rootPackage: rootPackage,
+            mode: .flatlist,
+            on: output
+        )
+        XCTAssertEqual(output.bytes.description, "dep\n")
+    }
+}
@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import Basics
+import _InternalTestSupport
+
+@testable
+import Commands
+
+import XCTest
+
+final class TestEnumerationCacheTests: XCTestCase {
+    func testCache() throws {
+        try testWithTemporaryDirectory { tmpPath in
+            let bundlePath = tmpPath.appending("PackageTests.xctest")
+            let cache = TestEnumerationCache(testProductAt: bundlePath, fileSystem: localFileSystem)
+            try localFileSystem.createDirectory(cache.binaryPath.parentDirectory, recursive: true)
+            try localFileSystem.writeFileContents(cache.binaryPath, string: "binary")
+
+            var enumerations = 0
+            func enumerate() -> String {
+                enumerations += 1
+                return "tests \(enumerations)"
+            }
+
+            XCTAssertEqual(try cache.output(orEnumerate: enumerate), "tests 1")
+            XCTAssertEqual(try cache.output(orEnumerate: enumerate), "tests 1")
+            XCTAssertEqual(enumerations, 1)
+
+            // A relinked binary is enumerated again.
+            try localFileSystem.removeFileTree(cache.binaryPath)
+            try localFileSystem.writeFileContents(cache.binaryPath, string: "relinked binary")
+            XCTAssertEqual(try cache.output(orEnumerate: enumerate), "tests 2")
+            XCTAssertEqual(try cache.output(orEnumerate: enumerate), "tests 2")
+            XCTAssertEqual(enumerations, 2)
+
+            // Without a binary there is nothing to key the cache with.
+            try localFileSystem.removeFileTree(cache.binaryPath)
+            XCTAssertEqual(try cache.output(orEnumerate: enumerate), "tests 3")
+            XCTAssertEqual(try cache.output(orEnumerate: enumerate), "tests 4")
+        }
+    }
+}
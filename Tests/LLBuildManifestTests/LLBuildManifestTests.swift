@@ -219,4 +219,45 @@ final class LLBuildManifestTests: XCTestCase {
             
             """)
     }
+
+    func testCriticalPath() throws {
+        // A large module an app depends on, and a small module nothing depends on, which are grouped by phony
+        // commands like the ones of modules and products in the manifests SwiftPM generates.
+        var manifest = LLBuildManifest()
+        manifest.addPhonyCmd(name: "C.Large", inputs: [], outputs: [.virtual("Large.module")])
+        manifest.addPhonyCmd(name: "C.Small", inputs: [], outputs: [.virtual("Small.module")])
+        manifest.addPhonyCmd(name: "C.App", inputs: [.virtual("Large.module")], outputs: [.virtual("App.module")])
+        manifest.addPhonyCmd(name: "C.App.exe", inputs: [.virtual("App.module")], outputs: [.virtual("App.exe")])
+        for name in ["Large.module", "Small.module", "App.exe"] {
+            manifest.addPhonyCmd(name: "P.\(name)", inputs: [.virtual(name)], outputs: [.virtual("\(name).target")])
+        }
+        for node in ["Small.module.target", "App.exe.target", "Large.module.target"] {
+            manifest.addNode(.virtual(node), toTarget: "main")
+        }
+
+        let durations = ["C.Large": 10.0, "C.Small": 5.0, "C.App": 1.0, "C.App.exe": 2.0]
+        XCTAssertEqual(
+            manifest.criticalPathLengths(commandDurations: durations),
+            [
+                "C.Large": 10, "C.Small": 5, "C.App": 11, "C.App.exe": 13,
+                "P.Large.module": 10, "P.Small.module": 5, "P.App.exe": 13,
+            ]
+        )
+
+        manifest.prioritizeCriticalPath(commandDurations: durations)
+        XCTAssertEqual(
+            manifest.targets["main"]?.nodes,
+            [.virtual("App.exe.target"), .virtual("Large.module.target"), .virtual("Small.module.target")]
+        )
+
+        // Nodes of commands without known durations keep their order.
+        manifest.addNode(.virtual("Other"), toTarget: "test")
+        manifest.addNode(.virtual("Small.module"), toTarget: "test")
+        manifest.addNode(.virtual("Another"), toTarget: "test")
+        manifest.prioritizeCriticalPath(commandDurations: durations)
+        XCTAssertEqual(
+            manifest.targets["test"]?.nodes,
+            [.virtual("Small.module"), .virtual("Other"), .virtual("Another")]
+        )
+    }
 }
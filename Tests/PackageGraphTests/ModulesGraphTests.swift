@@ -137,6 +137,102 @@ final class ModulesGraphTests: XCTestCase {
         }
     }
 
+    func testPreferDynamicLibraries() throws {
+        let fs = InMemoryFileSystem(emptyFiles:
+            "/App/Sources/App/main.swift",
+            "/App/Sources/AppCore/source.swift",
+            "/Core/Sources/Core/source.swift",
+            "/Core/Sources/CoreInternal/source.swift",
+            "/Core/Sources/Shared/source.swift",
+            "/Core/Sources/SharedExtras/source.swift",
+            "/Util/Sources/Util/source.swift",
+            "/Legacy/Sources/Legacy/source.swift"
+        )
+
+        let manifests = [
+            Manifest.createRootManifest(
+                displayName: "App",
+                path: "/App",
+                toolsVersion: .v5_9,
+                dependencies: [
+                    .fileSystem(path: "/Util"),
+                    .fileSystem(path: "/Legacy"),
+                ],
+                products: [
+                    ProductDescription(name: "AppCore", type: .library(.automatic), targets: ["AppCore"]),
+                ],
+                targets: [
+                    TargetDescription(name: "App", dependencies: [
+                        "AppCore",
+                        .product(name: "Util", package: "Util"),
+                        .product(name: "Legacy", package: "Legacy"),
+                    ], type: .executable),
+                    TargetDescription(name: "AppCore"),
+                ]
+            ),
+            Manifest.createFileSystemManifest(
+                displayName: "Core",
+                path: "/Core",
+                toolsVersion: .v5_9,
+                products: [
+                    ProductDescription(name: "Core", type: .library(.automatic), targets: ["Core"]),
+                    ProductDescription(name: "Shared", type: .library(.automatic), targets: ["Shared"]),
+                    ProductDescription(name: "SharedExtras", type: .library(.automatic), targets: ["SharedExtras"]),
+                ],
+                targets: [
+                    TargetDescription(name: "Core", dependencies: ["CoreInternal"]),
+                    TargetDescription(name: "CoreInternal"),
+                    TargetDescription(name: "Shared"),
+                    TargetDescription(name: "SharedExtras", dependencies: ["Shared"]),
+                ]
+            ),
+            Manifest.createFileSystemManifest(
+                displayName: "Util",
+                path: "/Util",
+                toolsVersion: .v5_9,
+                dependencies: [.fileSystem(path: "/Core")],
+                products: [ProductDescription(name: "Util", type: .library(.automatic), targets: ["Util"])],
+                targets: [TargetDescription(name: "Util", dependencies: [.product(name: "Core", package: "Core")])]
+            ),
+            Manifest.createFileSystemManifest(
+                displayName: "Legacy",
+                path: "/Legacy",
+                toolsVersion: .v5_9,
+                dependencies: [.fileSystem(path: "/Core")],
+                products: [ProductDescription(name: "Legacy", type: .library(.automatic), targets: ["Legacy"])],
+                targets: [
+                    TargetDescription(name: "Legacy", dependencies: [.product(name: "SharedExtras", package: "Core")]),
+                ]
+            ),
+        ]
+
+        let observability = ObservabilitySystem.makeForTesting()
+        let graph = try loadModulesGraph(fileSystem: fs, manifests: manifests, observabilityScope: observability.topScope)
+        XCTAssertNoDiagnostics(observability.diagnostics)
+        XCTAssertEqual(graph.product(for: "Core")?.type, .library(.automatic))
+
+        let dynamicGraph = try loadModulesGraph(
+            fileSystem: fs,
+            manifests: manifests,
+            preferDynamicLibraries: true,
+            observabilityScope: observability.topScope
+        )
+        XCTAssertNoDiagnostics(observability.diagnostics)
+
+        // A library whose modules aren't part of any other library is linked dynamically, and so are the libraries
+        // depending only on such libraries.
+        XCTAssertEqual(dynamicGraph.product(for: "Core")?.type, .library(.dynamic))
+        XCTAssertEqual(dynamicGraph.product(for: "Util")?.type, .library(.dynamic))
+
+        // Libraries sharing modules, and the ones depending on them, stay automatic.
+        XCTAssertEqual(dynamicGraph.product(for: "Shared")?.type, .library(.automatic))
+        XCTAssertEqual(dynamicGraph.product(for: "SharedExtras")?.type, .library(.automatic))
+        XCTAssertEqual(dynamicGraph.product(for: "Legacy")?.type, .library(.automatic))
+
+        // The modules of root packages are linked statically into their own executables anyway.
+        XCTAssertEqual(dynamicGraph.product(for: "AppCore")?.type, .library(.automatic))
+    }
+
     func testCycle() throws {
         let fs = InMemoryFileSystem(emptyFiles:
             "/Foo/Sources/Foo/source.swift",
@@ -15,6 +15,8 @@ import XCTest
 
 import PackageGraph
 
+import struct TSCUtility.Version
+
 final class VersionSetSpecifierTests: XCTestCase {
     func testUnion() {
         XCTAssertEqual(VersionSetSpecifier.union(from: ["1.0.0"..<"1.0.1"]), .exact("1.0.0"))
@@ -151,4 +153,50 @@ final class VersionSetSpecifierTests: XCTestCase {
         XCTAssertTrue(VersionSetSpecifier.range("2.0.1"..<"2.0.2") == VersionSetSpecifier.ranges(["2.0.1"..<"2.0.2"]))
         XCTAssertTrue(VersionSetSpecifier.ranges(["2.0.1"..<"2.0.2"]) == VersionSetSpecifier.range("2.0.1"..<"2.0.2"))
     }
+
+    func testSetRelationsMatchIntersection() {
+        // Deterministic pseudo-random sets, see https://prng.di.unimi.it/splitmix64.c
+        struct SplitMix64: RandomNumberGenerator {
+            var state: UInt64
+
+            mutating func next() -> UInt64 {
+                self.state &+= 0x9E37_79B9_7F4A_7C15
+                var z = self.state
+                z = (z ^ (z >> 30)) &* 0xBF58_476D_1CE4_E5B9
+                z = (z ^ (z >> 27)) &* 0x94D0_49BB_1331_11EB
+                return z ^ (z >> 31)
+            }
+        }
+
+        let versions: [Version] = [
+            "1.0.0-beta", "1.0.0", "1.0.1", "1.0.2", "1.0.5", "1.1.0", "1.1.1", "1.2.0", "2.0.0", "2.0.1", "3.0.0",
+        ]
+        var generator = SplitMix64(state: 42)
+
+        func randomRange() -> Range<Version> {
+            let bounds = [versions.randomElement(using: &generator)!, versions.randomElement(using: &generator)!]
+            return bounds.min()! ..< bounds.max()!
+        }
+
+        func randomSet() -> VersionSetSpecifier {
+            switch Int.random(in: 0 ..< 6, using: &generator) {
+            case 0:
+                return [.any, .empty, .ranges([])].randomElement(using: &generator)!
+            case 1:
+                return .exact(versions.randomElement(using: &generator)!)
+            case 2:
+                return .range(randomRange())
+            default:
+                return .union(from: (0 ..< Int.random(in: 1 ... 4, using: &generator)).map { _ in randomRange() })
+            }
+        }
+
+        for _ in 0 ..< 10000 {
+            let lhs = randomSet()
+            let rhs = randomSet()
+            let intersection = lhs.intersection(rhs)
+            XCTAssertEqual(lhs.isSuperset(of: rhs), intersection == rhs, "\(lhs) ⊇ \(rhs)")
+            XCTAssertEqual(lhs.isDisjoint(with: rhs), intersection == .empty, "\(lhs) ∩ \(rhs) = ∅")
+        }
+    }
 }
@@ -11,6 +11,7 @@
 //===----------------------------------------------------------------------===//
 
 import Basics
+import Foundation
 @testable import PackageLoading
 import PackageModel
 import _InternalTestSupport
@@ -219,4 +220,100 @@ class PkgConfigTests: XCTestCase {
         XCTAssertEqual(result.cFlags, ["-I/path/to/dependent/include", "-I/path/to/dependency/include"])
         XCTAssertEqual(result.libs, ["-L/path/to/dependent/lib", "-L/path/to/dependency/lib"])
     }
+
+    func testPersistentCache() throws {
+        try testWithTemporaryDirectory { tmpdir in
+            let firstDirectory = tmpdir.appending("first")
+            let secondDirectory = tmpdir.appending("second")
+            try localFileSystem.createDirectory(firstDirectory)
+            try localFileSystem.createDirectory(secondDirectory)
+            try localFileSystem.writeFileContents(secondDirectory.appending("Cached.pc"), string: """
+                Requires: CachedDependency
+                Cflags: -I/path/to/cached/include
+                """)
+            try localFileSystem.writeFileContents(secondDirectory.appending("CachedDependency.pc"), string: """
+                Libs: -L/path/to/dependency/lib
+                """)
+
+            // Modification dates may have a coarse resolution, so move them forward explicitly.
+            func touch(_ path: AbsolutePath) throws {
+                try FileManager.default.setAttributes(
+                    [.modificationDate: Date(timeIntervalSinceNow: 60)],
+                    ofItemAtPath: path.pathString
+                )
+            }
+
+            let cachePath = tmpdir.appending("pkg-config-cache.json")
+            let target = SystemLibraryModule(pkgConfig: "Cached")
+            func flags() throws -> (results: [PkgConfigResult], cached: Bool) {
+                let observability = ObservabilitySystem.makeForTesting()
+                var cache = PkgConfigCache(path: cachePath, fileSystem: localFileSystem)
+                let results = try cache.pkgConfigArgs(
+                    for: target,
+                    pkgConfigDirectories: [firstDirectory, secondDirectory],
+                    observabilityScope: observability.topScope
+                )
+                let cached = observability.diagnostics.contains { $0.message.contains("using cached pkg-config flags") }
+                return (results, cached)
+            }
+
+            var result = try flags()
+            XCTAssertFalse(result.cached)
+            XCTAssertEqual(result.results.map(\.cFlags), [["-I/path/to/cached/include"]])
+            XCTAssertEqual(result.results.map(\.libs), [["-L/path/to/dependency/lib"]])
+
+            result = try flags()
+            XCTAssertTrue(result.cached)
+            XCTAssertEqual(result.results.map(\.cFlags), [["-I/path/to/cached/include"]])
+            XCTAssertEqual(result.results.map(\.libs), [["-L/path/to/dependency/lib"]])
+
+            // Changing a required `.pc` file invalidates the entry.
+            try localFileSystem.writeFileContents(secondDirectory.appending("CachedDependency.pc"), string: """
+                Libs: -L/path/to/changed/lib
+                """)
+            try touch(secondDirectory.appending("CachedDependency.pc"))
+            result = try flags()
+            XCTAssertFalse(result.cached)
+            XCTAssertEqual(result.results.map(\.libs), [["-L/path/to/changed/lib"]])
+
+            // So does a `.pc` file that shadows a cached one.
+            try localFileSystem.writeFileContents(firstDirectory.appending("Cached.pc"), string: """
+                Cflags: -I/path/to/shadowing/include
+                """)
+            try touch(firstDirectory)
+            result = try flags()
+            XCTAssertFalse(result.cached)
+            XCTAssertEqual(result.results.map(\.cFlags), [["-I/path/to/shadowing/include"]])
+            XCTAssertTrue(try flags().cached)
+
+            // And a change of the environment.
+            try Environment.makeCustom(["PKG_CONFIG_SYSROOT_DIR": tmpdir.pathString]) {
+                XCTAssertFalse(try flags().cached)
+            }
+
+            // Results that came with warnings aren't cached, so that the warnings are emitted on every build.
+            try localFileSystem.writeFileContents(secondDirectory.appending("Circular.pc"), string: """
+                Requires: CircularDependency
+                """)
+            try localFileSystem.writeFileContents(secondDirectory.appending("CircularDependency.pc"), string: """
+                Requires: Circular
+                """)
+            for _ in 0 ..< 2 {
+                let observability = ObservabilitySystem.makeForTesting()
+                var cache = PkgConfigCache(path: cachePath, fileSystem: localFileSystem)
+                let results = try cache.pkgConfigArgs(
+                    for: SystemLibraryModule(pkgConfig: "Circular"),
+                    pkgConfigDirectories: [firstDirectory, secondDirectory],
+                    observabilityScope: observability.topScope
+                )
+                XCTAssertNil(results.first?.error)
+                XCTAssertTrue(observability.diagnostics.contains {
+                    $0.severity == .warning && $0.message.contains("circular dependency detected")
+                })
+                XCTAssertFalse(observability.diagnostics.contains {
+                    $0.message.contains("using cached pkg-config flags")
+                })
+            }
+        }
+    }
 }
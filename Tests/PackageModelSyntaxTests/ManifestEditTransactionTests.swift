@@ -0,0 +1,153 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+import Basics
+import PackageModel
+import PackageModelSyntax
+import _InternalTestSupport
+import XCTest
+
+import struct TSCBasic.FileSystemError
+import class TSCBasic.InMemoryFileSystem
+
+class ManifestEditTransactionTests: XCTestCase {
+    private func makeFileSystem() throws -> InMemoryFileSystem {
+        let fileSystem = InMemoryFileSystem()
+        for (path, name) in [("/client", "client"), ("/other", "other")] {
+            try fileSystem.createDirectory(AbsolutePath(validating: path), recursive: true)
+            try fileSystem.writeFileContents(AbsolutePath(validating: path).appending("Package.swift"), string: """
+                // swift-tools-version: 5.5
+                let package = Package(
+                    name: "\(name)"
+                )
+                """)
+        }
+        return fileSystem
+    }
+
+    func testBatchEdits() throws {
+        let fileSystem = try makeFileSystem()
+        var transaction = ManifestEditTransaction(fileSystem: fileSystem)
+        try transaction.apply(
+            .addPackageDependency(ManifestEditTests.swiftSystemPackageDependency),
+            toManifestAt: "/client/Package.swift"
+        )
+        try transaction.apply(
+            .addTarget(TargetDescription(name: "MyLib")),
+            toManifestAt: "/client/Package.swift"
+        )
+        try transaction.apply(
+            .addTargetDependency(.product(name: "SystemPackage", package: "swift-system"), targetName: "MyLib"),
+            toManifestAt: "/client/Package.swift"
+        )
+        try transaction.apply(
+            .addProduct(ProductDescription(name: "MyLib", type: .library(.automatic), targets: ["MyLib"])),
+            toManifestAt: "/client/Package.swift"
+        )
+        try transaction.apply(
+            .addTarget(TargetDescription(name: "OtherLib")),
+            toManifestAt: "/other/Package.swift"
+        )
+        XCTAssertEqual(transaction.manifestPaths, ["/client/Package.swift", "/other/Package.swift"])
+
+        // Nothing is written before the transaction is committed.
+        let original: String = try fileSystem.readFileContents("/client/Package.swift")
+        XCTAssertNoMatch(original, .contains("MyLib"))
+        XCTAssertFalse(fileSystem.exists("/client/Sources/MyLib/MyLib.swift"))
+
+        try transaction.commit(verbose: false)
+
+        let client: String = try fileSystem.readFileContents("/client/Package.swift")
+        XCTAssertMatch(client, .contains(#".package(url: "https://github.com/apple/swift-system.git", branch: "main")"#))
+        XCTAssertMatch(client, .contains(#".product(name: "SystemPackage", package: "swift-system")"#))
+        XCTAssertMatch(client, .contains(#"products: ["#))
+        XCTAssertMatch(client, .contains(#"name: "MyLib""#))
+        XCTAssertTrue(fileSystem.exists("/client/Sources/MyLib/MyLib.swift"))
+
+        let other: String = try fileSystem.readFileContents("/other/Package.swift")
+        XCTAssertMatch(other, .contains(#"name: "OtherLib""#))
+        XCTAssertTrue(fileSystem.exists("/other/Sources/OtherLib/OtherLib.swift"))
+    }
+
+    func testConflicts() throws {
+        let fileSystem = try makeFileSystem()
+        var transaction = ManifestEditTransaction(fileSystem: fileSystem)
+        try transaction.apply(.addTarget(TargetDescription(name: "MyLib")), toManifestAt: "/client/Package.swift")
+        try transaction.apply(
+            .addTargetDependency(.target(name: "Dep", condition: nil), targetName: "MyLib"),
+            toManifestAt: "/client/Package.swift"
+        )
+
+        XCTAssertThrows(
+            try transaction.apply(.addTarget(TargetDescription(name: "MyLib")), toManifestAt: "/client/Package.swift")
+        ) { (error: ManifestEditError) in
+            if case .duplicateTarget(targetName: "MyLib") = error {
+                return true
+            } else {
+                return false
+            }
+        }
+
+        XCTAssertThrows(
+            try transaction.apply(
+                .addTargetDependency(.byName(name: "Dep", condition: nil), targetName: "MyLib"),
+                toManifestAt: "/client/Package.swift"
+            )
+        ) { (error: ManifestEditError) in
+            if case .duplicateTargetDependency(dependencyName: "Dep", targetName: "MyLib") = error {
+                return true
+            } else {
+                return false
+            }
+        }
+
+        // A manifest that changed since it was read isn't overwritten.
+        try fileSystem.writeFileContents("/client/Package.swift", string: "// swift-tools-version: 5.5\n")
+        XCTAssertThrows(try transaction.commit(verbose: false)) { (error: ManifestEditError) in
+            if case .manifestModified = error {
+                return true
+            } else {
+                return false
+            }
+        }
+        XCTAssertFalse(fileSystem.exists("/client/Sources/MyLib/MyLib.swift"))
+    }
+
+    func testFailedWriteRestoresManifests() throws {
+        let fileSystem = try makeFileSystem()
+        // The in-memory file system reads through symbolic links but can't
+        // write to them, so writing the second manifest fails.
+        try fileSystem.move(from: "/other/Package.swift", to: "/other/Package@swift-5.5.swift")
+        try fileSystem.createSymbolicLink(
+            "/other/Package.swift",
+            pointingAt: "/other/Package@swift-5.5.swift",
+            relative: true
+        )
+        let originalClient: String = try fileSystem.readFileContents("/client/Package.swift")
+        let originalOther: String = try fileSystem.readFileContents("/other/Package.swift")
+
+        var transaction = ManifestEditTransaction(fileSystem: fileSystem)
+        try transaction.apply(.addTarget(TargetDescription(name: "MyLib")), toManifestAt: "/client/Package.swift")
+        try transaction.apply(.addTarget(TargetDescription(name: "OtherLib")), toManifestAt: "/other/Package.swift")
+
+        XCTAssertThrows(try transaction.commit(verbose: false)) { (error: FileSystemError) in
+            error.kind == .isDirectory
+        }
+
+        // The first manifest is restored and no auxiliary file is written.
+        let client: String = try fileSystem.readFileContents("/client/Package.swift")
+        XCTAssertEqual(client, originalClient)
+        let other: String = try fileSystem.readFileContents("/other/Package.swift")
+        XCTAssertEqual(other, originalOther)
+        XCTAssertFalse(fileSystem.exists("/client/Sources/MyLib/MyLib.swift"))
+        XCTAssertFalse(fileSystem.exists("/other/Sources/OtherLib/OtherLib.swift"))
+    }
+}
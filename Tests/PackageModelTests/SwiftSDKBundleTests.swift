@@ -17,6 +17,7 @@ import _InternalTestSupport
 import XCTest
 
 import struct TSCBasic.ByteString
+import struct TSCBasic.SHA256
 import protocol TSCBasic.FileSystem
 import class TSCBasic.InMemoryFileSystem
 
@@ -189,6 +190,114 @@ final class SwiftSDKBundleTests: XCTestCase {
         }
     }
 
+    func testInstallRemoteResumeAndChecksum() async throws {
+        let system = ObservabilitySystem.makeForTesting()
+        let (fileSystem, bundles, swiftSDKsDirectory) = try generateTestFileSystem(
+            bundleArtifacts: [.init(id: testArtifactID, supportedTriples: [arm64Triple])]
+        )
+        let bundleFiles = try generateBundleFiles(bundle: bundles[0])
+        let archiveContents = ByteString(encodingAsUTF8: "archive")
+        let bundleURLString = "https://localhost/test0.zip"
+        let bundleURL = URL(string: bundleURLString)!
+
+        let downloadsCount = ThreadSafeBox(0)
+        let httpClient = HTTPClient { request, _ in
+            guard case let .download(fileSystem, downloadPath) = request.kind else {
+                XCTFail("Unexpected HTTPClient.Request.Kind")
+                return .init(statusCode: 400)
+            }
+            downloadsCount.increment()
+            try fileSystem.writeFileContents(downloadPath, bytes: archiveContents)
+            return .init(statusCode: 200)
+        }
+
+        // Simulates an installation interrupted while the archive is extracted.
+        let failingArchiver = MockArchiver(handler: { _, _, _, completion in
+            completion(.failure(StringError("interrupted")))
+        })
+        let archiver = MockArchiver(handler: { _, _, destination, completion in
+            for (path, contents) in bundleFiles {
+                try fileSystem.writeFileContents(
+                    destination.appending(RelativePath(validating: String(path.dropFirst()))),
+                    bytes: contents
+                )
+            }
+            completion(.success(()))
+        })
+
+        var output = [SwiftSDKBundleStore.Output]()
+        let store = SwiftSDKBundleStore(
+            swiftSDKsDirectory: swiftSDKsDirectory,
+            fileSystem: fileSystem,
+            observabilityScope: system.topScope,
+            outputHandler: {
+                output.append($0)
+            }
+        )
+
+        let stagingRoot = swiftSDKsDirectory.appending(component: ".install-staging")
+        let stagingDirectory = stagingRoot.appending(
+            component: SHA256().hash(ByteString(encodingAsUTF8: bundleURLString)).hexadecimalRepresentation
+        )
+
+        // A failed installation removes everything it staged.
+        await XCTAssertAsyncThrowsError(
+            try await store.install(bundlePathOrURL: bundleURLString, failingArchiver, httpClient)
+        )
+        XCTAssertEqual(downloadsCount.get(), 1)
+        XCTAssertFalse(fileSystem.exists(stagingDirectory))
+
+        // Simulates an installation killed after downloading the archive.
+        let stagedArchivePath = stagingDirectory.appending(components: "download", "test0.zip")
+        try fileSystem.createDirectory(stagedArchivePath.parentDirectory, recursive: true)
+        try fileSystem.writeFileContents(stagedArchivePath, bytes: archiveContents)
+
+        // A staged archive that doesn't match the checksum is downloaded again.
+        do {
+            try await store.install(bundlePathOrURL: bundleURLString, checksum: "0000", archiver, httpClient)
+            XCTFail("Function expected to throw")
+        } catch SwiftSDKError.checksumMismatch(_, let expected, let actual) {
+            XCTAssertEqual(expected, "0000")
+            XCTAssertEqual(actual, SHA256().hash(archiveContents).hexadecimalRepresentation)
+        }
+        XCTAssertEqual(downloadsCount.get(), 2)
+        XCTAssertFalse(fileSystem.exists(stagingDirectory))
+
+        // A staged archive that matches the checksum is reused.
+        try fileSystem.createDirectory(stagedArchivePath.parentDirectory, recursive: true)
+        try fileSystem.writeFileContents(stagedArchivePath, bytes: archiveContents)
+        try await store.install(
+            bundlePathOrURL: bundleURLString,
+            checksum: SHA256().hash(archiveContents).hexadecimalRepresentation,
+            archiver,
+            httpClient
+        )
+        XCTAssertEqual(downloadsCount.get(), 2)
+        XCTAssertEqual(try store.allValidBundles.map(\.name), [bundles[0].name])
+        XCTAssertFalse(fileSystem.exists(stagingDirectory))
+
+        // Installing the same bundle again fails without leaving anything behind.
+        await XCTAssertAsyncThrowsError(
+            try await store.install(bundlePathOrURL: bundleURLString, archiver, httpClient)
+        )
+        XCTAssertEqual(downloadsCount.get(), 3)
+        XCTAssertFalse(fileSystem.exists(stagingDirectory))
+
+        XCTAssertEqual(output, [
+            .downloadStarted(bundleURL),
+            .downloadFinishedSuccessfully(bundleURL),
+            .unpackingArchive(bundlePathOrURL: bundleURLString),
+            .downloadStarted(bundleURL),
+            .downloadFinishedSuccessfully(bundleURL),
+            .reusingDownloadedArchive(bundleURL),
+            .unpackingArchive(bundlePathOrURL: bundleURLString),
+            .installationSuccessful(bundlePathOrURL: bundleURLString, bundleName: bundles[0].name),
+            .downloadStarted(bundleURL),
+            .downloadFinishedSuccessfully(bundleURL),
+            .unpackingArchive(bundlePathOrURL: bundleURLString),
+        ])
+    }
+
     func testInstall() async throws {
         let system = ObservabilitySystem.makeForTesting()
 
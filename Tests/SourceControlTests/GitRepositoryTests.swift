@@ -530,6 +530,28 @@ class GitRepositoryTests: XCTestCase {
         }
     }
 
+    func testResolveTagRevisions() throws {
+        try testWithTemporaryDirectory { path in
+            // Create a repo.
+            let repositoryPath = path.appending("test-repo")
+            try makeDirectories(repositoryPath)
+            initGitRepo(repositoryPath)
+
+            let repo = GitRepository(path: repositoryPath)
+            XCTAssertEqual(try repo.resolveTagRevisions(), [:])
+
+            try repo.tag(name: "1.0.0")
+            try systemQuietly([Git.tool, "-C", repositoryPath.pathString, "tag", "-a", "2.0.0", "-m", "Annotated"])
+
+            // Annotated tags resolve to the commit they point to, like `resolveRevision(tag:)`.
+            let revisions = try GitRepository(path: repositoryPath).resolveTagRevisions()
+            XCTAssertEqual(revisions.count, 2)
+            XCTAssertEqual(revisions["1.0.0"], try repo.resolveRevision(tag: "1.0.0"))
+            XCTAssertEqual(revisions["2.0.0"], try repo.resolveRevision(tag: "2.0.0"))
+            XCTAssertEqual(revisions["2.0.0"], try repo.getCurrentRevision())
+        }
+    }
+
     func testCheckoutRevision() throws {
         try testWithTemporaryDirectory { path in
             // Create a repo.
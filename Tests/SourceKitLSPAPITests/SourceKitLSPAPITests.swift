@@ -82,6 +82,73 @@ final class SourceKitLSPAPITests: XCTestCase {
             isPartOfRootPackage: true
         )
     }
+
+    func testSourceFileUpdates() throws {
+        let fs = InMemoryFileSystem(emptyFiles:
+            "/Pkg/Sources/exe/main.swift",
+            "/Pkg/Sources/lib/lib.swift",
+            "/Pkg/Sources/clib/clib.c",
+            "/Pkg/Sources/clib/include/clib.h"
+        )
+
+        let observability = ObservabilitySystem.makeForTesting()
+        let graph = try loadModulesGraph(
+            fileSystem: fs,
+            manifests: [
+                Manifest.createRootManifest(
+                    displayName: "Pkg",
+                    path: "/Pkg",
+                    toolsVersion: .v5_9,
+                    targets: [
+                        TargetDescription(name: "exe", dependencies: ["lib", "clib"]),
+                        TargetDescription(name: "lib", dependencies: []),
+                        TargetDescription(name: "clib", dependencies: []),
+                    ]),
+            ],
+            observabilityScope: observability.topScope
+        )
+        XCTAssertNoDiagnostics(observability.diagnostics)
+
+        let plan = try BuildPlan(
+            destinationBuildParameters: mockBuildParameters(destination: .target),
+            toolsBuildParameters: mockBuildParameters(destination: .host),
+            graph: graph,
+            fileSystem: fs,
+            observabilityScope: observability.topScope
+        )
+        let description = BuildDescription(buildPlan: plan)
+
+        XCTAssertTrue(description.fileAffectsSwiftOrClangBuildSettings(URL(fileURLWithPath: "/Pkg/Package.swift")))
+        XCTAssertTrue(description.fileAffectsSwiftOrClangBuildSettings(URL(fileURLWithPath: "/Pkg/Sources/lib/new.swift")))
+        XCTAssertFalse(description.fileAffectsSwiftOrClangBuildSettings(URL(fileURLWithPath: "/Pkg/README.md")))
+
+        let lib = try XCTUnwrap(graph.module(for: "lib", destination: .destination))
+        let clib = try XCTUnwrap(graph.module(for: "clib", destination: .destination))
+
+        let updatedTargets = description.updateSourceFiles(
+            added: [
+                URL(fileURLWithPath: "/Pkg/Sources/lib/nested/new.swift"),
+                URL(fileURLWithPath: "/Pkg/Sources/lib/notes.txt"),
+                URL(fileURLWithPath: "/Pkg/Sources/clib/other.c"),
+                URL(fileURLWithPath: "/Pkg/Other/outside.swift"),
+            ],
+            removed: [URL(fileURLWithPath: "/Pkg/Sources/clib/clib.c")]
+        )
+        XCTAssertEqual(Set(updatedTargets.map(\.name)), ["lib", "clib"])
+
+        let libTarget = try XCTUnwrap(description.getBuildTarget(for: lib, in: graph))
+        XCTAssertEqual(libTarget.sources.map(\.path), ["/Pkg/Sources/lib/lib.swift", "/Pkg/Sources/lib/nested/new.swift"])
+        XCTAssertTrue(try libTarget.compileArguments(for: libTarget.sources[0]).contains("/Pkg/Sources/lib/nested/new.swift"))
+
+        let clibTarget = try XCTUnwrap(description.getBuildTarget(for: clib, in: graph))
+        XCTAssertEqual(clibTarget.sources.map(\.path), ["/Pkg/Sources/clib/other.c"])
+
+        // Applying the same changes again doesn't change anything.
+        XCTAssertTrue(description.updateSourceFiles(
+            added: [URL(fileURLWithPath: "/Pkg/Sources/lib/nested/new.swift")],
+            removed: [URL(fileURLWithPath: "/Pkg/Sources/clib/clib.c")]
+        ).isEmpty)
+    }
 }
 
 extension SourceKitLSPAPI.BuildDescription {
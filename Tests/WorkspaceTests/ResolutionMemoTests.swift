@@ -0,0 +1,104 @@
+//===----------------------------------------------------------------------===//
+//
+// This source file is part of the Swift open source project
+//
+// Copyright (c) 2024 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See http://swift.org/LICENSE.txt for license information
+// See http://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+
+import Basics
+import PackageGraph
+import PackageModel
+import SourceControl
+import _InternalTestSupport
+@testable import Workspace
+import XCTest
+
+import struct TSCUtility.Version
+
+final class ResolutionMemoTests: XCTestCase {
+    func testRoundTrip() throws {
+        try testWithTemporaryDirectory { tmpPath in
+            let observability = ObservabilitySystem.makeForTesting()
+            let path = tmpPath.appending(components: "resolution", "memo.db")
+            let memo = ResolutionMemo(path: path, currentToolsVersion: .current, mirrors: .init())
+
+            let package = PackageReference.remoteSourceControl(
+                identity: .plain("foo"),
+                url: "https://example.com/foo.git"
+            )
+            let revision = Revision(identifier: "abcdef")
+            let dependencies = [
+                PackageContainerConstraint(
+                    package: .remoteSourceControl(identity: .plain("bar"), url: "https://example.com/bar.git"),
+                    versionRequirement: .range("1.0.0" ..< "2.0.0"),
+                    products: .specific(["Bar"])
+                ),
+                PackageContainerConstraint(
+                    package: .localSourceControl(identity: .plain("baz"), path: "/baz"),
+                    requirement: .revision("main"),
+                    products: .everything
+                ),
+            ]
+
+            XCTAssertNil(memo.toolsVersion(of: package, at: revision, observabilityScope: observability.topScope))
+            memo.setToolsVersion(.v5_9, of: package, at: revision, observabilityScope: observability.topScope)
+            memo.setDependencies(
+                dependencies,
+                of: package,
+                at: revision,
+                productFilter: .everything,
+                observabilityScope: observability.topScope
+            )
+
+            // A fresh memo reads what was written by another workspace.
+            let otherMemo = ResolutionMemo(path: path, currentToolsVersion: .current, mirrors: .init())
+            XCTAssertEqual(
+                otherMemo.toolsVersion(of: package, at: revision, observabilityScope: observability.topScope),
+                .v5_9
+            )
+            XCTAssertEqual(
+                otherMemo.toolsVersions(
+                    of: package,
+                    at: [revision, Revision(identifier: "123456")],
+                    observabilityScope: observability.topScope
+                ),
+                [revision: .v5_9]
+            )
+            let memoized = try XCTUnwrap(otherMemo.dependencies(
+                of: package,
+                at: revision,
+                productFilter: .everything,
+                observabilityScope: observability.topScope
+            ))
+            XCTAssertEqual(memoized.map(\.package), dependencies.map(\.package))
+            XCTAssertEqual(memoized.map(\.requirement), dependencies.map(\.requirement))
+            XCTAssertEqual(memoized.map(\.products), dependencies.map(\.products))
+
+            // Other product filters, revisions and tools versions don't match.
+            XCTAssertNil(otherMemo.dependencies(
+                of: package,
+                at: revision,
+                productFilter: .specific(["Foo"]),
+                observabilityScope: observability.topScope
+            ))
+            XCTAssertNil(otherMemo.toolsVersion(
+                of: package,
+                at: Revision(identifier: "123456"),
+                observabilityScope: observability.topScope
+            ))
+            let newerMemo = ResolutionMemo(path: path, currentToolsVersion: .vNext, mirrors: .init())
+            XCTAssertNil(newerMemo.toolsVersion(of: package, at: revision, observabilityScope: observability.topScope))
+
+            // A closed memo reopens its database when it's used again.
+            try memo.close()
+            XCTAssertEqual(memo.toolsVersion(of: package, at: revision, observabilityScope: observability.topScope), .v5_9)
+
+            XCTAssertNoDiagnostics(observability.diagnostics)
+        }
+    }
+}
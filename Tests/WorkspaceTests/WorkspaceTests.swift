@@ -262,6 +262,120 @@ final class WorkspaceTests: XCTestCase {
         }
     }
 
+    func testCollectGarbage() throws {
+        try testWithTemporaryDirectory { path in
+            let fs = localFileSystem
+            let packagePath = path.appending("MyPkg")
+            let workspace = try Workspace(
+                fileSystem: fs,
+                forRootPackage: packagePath,
+                customManifestLoader: MockManifestLoader(manifests: [:]),
+                delegate: MockWorkspaceDelegate()
+            )
+
+            let scratchDirectory = workspace.location.scratchDirectory
+            let tripleDirectory = scratchDirectory.appending("x86_64-unknown-linux-gnu")
+            let debug = tripleDirectory.appending("debug")
+            let release = tripleDirectory.appending("release")
+            let moduleCache = debug.appending("ModuleCache")
+            let checkout = workspace.location.repositoriesCheckoutsDirectory.appending("dep")
+            let plugins = scratchDirectory.appending("plugins")
+
+            try fs.writeFileContents(debug.appending("a.o"), string: String(repeating: "a", count: 1000))
+            try fs.writeFileContents(moduleCache.appending("b.pcm"), string: String(repeating: "b", count: 1000))
+            try fs.writeFileContents(release.appending("c.o"), string: String(repeating: "c", count: 1000))
+            try fs.writeFileContents(checkout.appending("d.swift"), string: String(repeating: "d", count: 1000))
+            try fs.writeFileContents(plugins.appending("e.o"), string: String(repeating: "e", count: 1000))
+
+            // Make the module cache the least recently used entry, followed by the debug configuration.
+            func setModificationDate(_ date: Date, _ paths: AbsolutePath...) throws {
+                for path in paths {
+                    try FileManager.default.setAttributes([.modificationDate: date], ofItemAtPath: path.pathString)
+                }
+            }
+            try setModificationDate(Date(timeIntervalSinceNow: -300), moduleCache, moduleCache.appending("b.pcm"))
+            try setModificationDate(Date(timeIntervalSinceNow: -200), debug, debug.appending("a.o"))
+            // Other contents of the scratch directory aren't build directories, however old they are.
+            try setModificationDate(Date(timeIntervalSinceNow: -400), plugins, plugins.appending("e.o"))
+
+            let observability = ObservabilitySystem.makeForTesting()
+            var result = workspace.collectGarbage(
+                limits: .init(scratchDirectorySize: 2000),
+                observabilityScope: observability.topScope
+            )
+            XCTAssertNoDiagnostics(observability.diagnostics)
+            XCTAssertEqual(result.removedPaths, [moduleCache])
+            XCTAssertEqual(result.reclaimedBytes, 1000)
+            XCTAssertTrue(fs.exists(debug.appending("a.o")))
+
+            // Protected build directories and the workspace state are never evicted.
+            result = workspace.collectGarbage(
+                limits: .init(scratchDirectorySize: 0),
+                protectedPaths: [release],
+                observabilityScope: observability.topScope
+            )
+            XCTAssertNoDiagnostics(observability.diagnostics)
+            XCTAssertEqual(result.removedPaths, [debug])
+            XCTAssertEqual(result.reclaimedBytes, 1000)
+            XCTAssertTrue(fs.exists(release.appending("c.o")))
+            XCTAssertTrue(fs.exists(checkout.appending("d.swift")))
+            XCTAssertTrue(fs.exists(plugins.appending("e.o")))
+        }
+    }
+
+    func testCollectSharedCacheGarbage() throws {
+        try testWithTemporaryDirectory { path in
+            let fs = localFileSystem
+            var location = try Workspace.Location(forRootPackage: path.appending("MyPkg"), fileSystem: fs)
+            location.sharedCacheDirectory = path.appending("cache")
+            let workspace = try Workspace(
+                fileSystem: fs,
+                location: location,
+                customManifestLoader: MockManifestLoader(manifests: [:]),
+                delegate: MockWorkspaceDelegate()
+            )
+
+            // Binary artifacts are cached as files, registry downloads as directories.
+            let artifactsCache = try XCTUnwrap(location.sharedBinaryArtifactsCacheDirectory)
+            let oldArtifact = artifactsCache.appending("old_zip")
+            let newArtifact = artifactsCache.appending("new_zip")
+            let lockedArtifact = artifactsCache.appending("locked_zip")
+            let registryDownload = try XCTUnwrap(location.sharedRegistryDownloadsCacheDirectory)
+                .appending(components: "scope", "name", "1.0.0")
+            for file in [oldArtifact, newArtifact, lockedArtifact, registryDownload.appending("Package.swift")] {
+                try fs.writeFileContents(file, string: String(repeating: "a", count: 1000))
+            }
+
+            func setModificationDate(_ date: Date, _ paths: AbsolutePath...) throws {
+                for path in paths {
+                    try FileManager.default.setAttributes([.modificationDate: date], ofItemAtPath: path.pathString)
+                }
+            }
+            try setModificationDate(Date(timeIntervalSinceNow: -400), lockedArtifact)
+            try setModificationDate(Date(timeIntervalSinceNow: -300), oldArtifact)
+            try setModificationDate(
+                Date(timeIntervalSinceNow: -200),
+                registryDownload,
+                registryDownload.appending("Package.swift")
+            )
+
+            // The least recently used artifact is in use, so the next ones are evicted instead.
+            let observability = ObservabilitySystem.makeForTesting()
+            let result = try fs.withLock(on: lockedArtifact, type: .exclusive) {
+                workspace.collectGarbage(
+                    limits: .init(sharedCacheSize: 2000),
+                    observabilityScope: observability.topScope
+                )
+            }
+            XCTAssertEqual(result.removedPaths, [oldArtifact, registryDownload])
+            XCTAssertEqual(result.reclaimedBytes, 2000)
+            XCTAssertTrue(fs.exists(lockedArtifact))
+            XCTAssertTrue(fs.exists(newArtifact))
+            XCTAssertFalse(fs.exists(oldArtifact))
+            XCTAssertFalse(fs.exists(registryDownload))
+        }
+    }
+
     func testMultipleRootPackages() throws {
         let sandbox = AbsolutePath("/tmp/ws/")
         let fs = InMemoryFileSystem()